@@ -0,0 +1,95 @@
+#ifndef GRAPPH_BITSET_H
+#define GRAPPH_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace grapph {
+
+    // Fixed-size set of dense positions 0..n-1 packed into 64-bit words, for
+    // candidate sets and adjacency rows where std::set would be too slow
+    class Bitset {
+
+    private:
+
+        std::vector<uint64_t> words;
+        size_t num_bits = 0;
+
+        static size_t lowestBit(uint64_t word) { return __builtin_ctzll(word); }
+
+    public:
+
+        static const size_t npos = static_cast<size_t>(-1);
+
+        Bitset() = default;
+        explicit Bitset(size_t bits, bool value = false)
+                : words((bits + 63) / 64, value ? ~uint64_t(0) : 0), num_bits(bits) {
+            // Keep bits past the end clear so count and scans stay exact
+            if ( value && bits % 64 != 0 ) { words.back() = (uint64_t(1) << (bits % 64)) - 1; }
+        }
+
+        size_t size() const { return num_bits; }
+
+        bool test(size_t i) const { return (words[i >> 6] >> (i & 63)) & 1; }
+        void set(size_t i) { words[i >> 6] |= uint64_t(1) << (i & 63); }
+        void reset(size_t i) { words[i >> 6] &= ~(uint64_t(1) << (i & 63)); }
+        void clear() { for ( uint64_t & word : words ) { word = 0; } }
+
+        size_t count() const {
+            size_t total = 0;
+            for ( uint64_t word : words ) { total += __builtin_popcountll(word); }
+            return total;
+        }
+
+        bool none() const {
+            for ( uint64_t word : words ) { if ( word != 0 ) { return false; } }
+            return true;
+        }
+        bool any() const { return !none(); }
+
+        // First set position at or after i, or npos
+        size_t findFrom(size_t i) const {
+            if ( i >= num_bits ) { return npos; }
+
+            size_t w = i >> 6;
+            uint64_t word = words[w] & (~uint64_t(0) << (i & 63));
+            while ( word == 0 ) {
+                if ( ++w == words.size() ) { return npos; }
+                word = words[w];
+            }
+            return (w << 6) + lowestBit(word);
+        }
+        size_t findFirst() const { return findFrom(0); }
+        size_t findNext(size_t i) const { return findFrom(i + 1); }
+
+        // Word-wise set operations; both sides must be the same size
+        Bitset& intersect(const Bitset & other) {
+            for ( size_t w = 0; w < words.size(); w++ ) { words[w] &= other.words[w]; }
+            return *this;
+        }
+        Bitset& unite(const Bitset & other) {
+            for ( size_t w = 0; w < words.size(); w++ ) { words[w] |= other.words[w]; }
+            return *this;
+        }
+        Bitset& subtract(const Bitset & other) {
+            for ( size_t w = 0; w < words.size(); w++ ) { words[w] &= ~other.words[w]; }
+            return *this;
+        }
+
+        size_t intersectionCount(const Bitset & other) const {
+            size_t total = 0;
+            for ( size_t w = 0; w < words.size(); w++ ) { total += __builtin_popcountll(words[w] & other.words[w]); }
+            return total;
+        }
+
+        bool operator==(const Bitset & other) const { return num_bits == other.num_bits && words == other.words; }
+        bool operator!=(const Bitset & other) const { return !(*this == other); }
+
+        const std::vector<uint64_t>& getWords() const { return words; }
+
+    };
+
+}
+
+#endif //GRAPPH_BITSET_H
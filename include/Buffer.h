@@ -0,0 +1,132 @@
+#ifndef GRAPPH_BUFFER_H
+#define GRAPPH_BUFFER_H
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace grapph {
+
+    // Elements a Buffer owns
+    template <typename T>
+    struct BufferStorage {
+
+        std::vector<T> values;
+
+        BufferStorage() = default;
+        explicit BufferStorage(std::vector<T> values) : values(std::move(values)) {}
+        template <typename Iterator>
+        BufferStorage(Iterator first, Iterator last) : values(first, last) {}
+
+        T* data() { return values.data(); }
+        size_t size() const { return values.size(); }
+        void swap(BufferStorage & other) { values.swap(other.values); }
+
+    };
+
+    // vector<bool> packs its elements into words and has no data(), so owned
+    // bools are kept one per byte in a plain array instead
+    template <>
+    struct BufferStorage<bool> {
+
+        std::unique_ptr<bool[]> values;
+        size_t count = 0;
+
+        BufferStorage() = default;
+        explicit BufferStorage(const std::vector<bool> & source) : BufferStorage(source.begin(), source.end()) {}
+        template <typename Iterator>
+        BufferStorage(Iterator first, Iterator last)
+        : values(new bool[std::distance(first, last)]), count(std::distance(first, last)) {
+            std::copy(first, last, values.get());
+        }
+
+        bool* data() { return values.get(); }
+        size_t size() const { return count; }
+        void swap(BufferStorage & other) {
+            values.swap(other.values);
+            std::swap(count, other.count);
+        }
+
+    };
+
+    // Fixed-size array that either owns its elements or borrows them from
+    // storage it does not manage, such as the pages of a mapped snapshot; the
+    // owner handle keeps borrowed storage alive for as long as any buffer
+    // points into it. Copies always own their elements, so writing through
+    // one copy is never seen by another; moves keep borrowed storage borrowed.
+    template <typename T>
+    class Buffer {
+
+    public:
+
+        typedef T value_type;
+        typedef T* iterator;
+        typedef const T* const_iterator;
+
+    private:
+
+        BufferStorage<T> owned;
+        std::shared_ptr<const void> owner;
+
+        T* first = nullptr;
+        size_t count = 0;
+
+    public:
+
+        Buffer() = default;
+
+        Buffer(std::vector<T> values) : owned(std::move(values)), first(owned.data()), count(owned.size()) {}
+
+        Buffer(T* data, size_t count, std::shared_ptr<const void> owner)
+        : owner(std::move(owner)), first(data), count(count) {}
+
+        Buffer(const Buffer & other) : owned(other.begin(), other.end()), first(owned.data()), count(owned.size()) {}
+
+        // A moved vector keeps its storage, so first stays valid
+        Buffer(Buffer && other) noexcept
+        : owned(std::move(other.owned)), owner(std::move(other.owner)), first(other.first), count(other.count) {
+            other.first = nullptr;
+            other.count = 0;
+        }
+
+        Buffer& operator=(Buffer other) noexcept {
+            owned.swap(other.owned);
+            owner.swap(other.owner);
+            std::swap(first, other.first);
+            std::swap(count, other.count);
+            return *this;
+        }
+
+        // Whether the elements live in storage the buffer does not own
+        bool isBorrowed() const { return owner != nullptr; }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        T* data() { return first; }
+        const T* data() const { return first; }
+
+        T& operator[](size_t i) { return first[i]; }
+        const T& operator[](size_t i) const { return first[i]; }
+
+        iterator begin() { return first; }
+        iterator end() { return first + count; }
+        const_iterator begin() const { return first; }
+        const_iterator end() const { return first + count; }
+
+        friend bool operator==(const Buffer & a, const Buffer & b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+        }
+        friend bool operator==(const Buffer & a, const std::vector<T> & b) {
+            return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+        }
+        friend bool operator==(const std::vector<T> & a, const Buffer & b) { return b == a; }
+
+    };
+
+}
+
+#endif //GRAPPH_BUFFER_H
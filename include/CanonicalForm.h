@@ -0,0 +1,67 @@
+#ifndef GRAPPH_CANONICALFORM_H
+#define GRAPPH_CANONICALFORM_H
+
+#include "Graph.h"
+#include "Homomorphism.h"
+#include "VertexIndex.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace grapph {
+
+    // Relabels a graph's vertices 0..n-1 so that two graphs get the same
+    // relabeled edge list exactly when they are isomorphic. Colors are refined
+    // until equitable (Weisfeiler-Lehman style), then a search tree
+    // individualizes one vertex of the first non-singleton cell at a time.
+    // Subtrees whose refinement trace is already worse than the best leaf are
+    // cut, and automorphisms found between equal leaves prune sibling
+    // branches that lie in the same orbit.
+    class CanonicalForm {
+
+    private:
+
+        VertexIndex index;
+
+        // Canonical label of each vertex position, and its inverse
+        std::vector<size_t> labels;
+        std::vector<size_t> positions;
+
+        // Edges over canonical labels, ordered and sorted
+        std::vector<edge_t> edges;
+
+        uint64_t hash = 0;
+
+    public:
+
+        explicit CanonicalForm(Graph&);
+
+        size_t getNumVertices() const { return labels.size(); }
+        const std::vector<edge_t>& getEdges() const { return edges; }
+        uint64_t getHash() const { return hash; }
+
+        vertex_t getLabel(vertex_t) const;
+        vertex_t getVertex(vertex_t) const;
+
+        // The canonical graph itself, on vertices 0..n-1
+        Graph toGraph() const;
+
+        bool operator==(const CanonicalForm & other) const {
+            return labels.size() == other.labels.size() && edges == other.edges;
+        }
+        bool operator!=(const CanonicalForm & other) const { return !(*this == other); }
+
+        static bool isIsomorphic(Graph&, Graph&);
+
+        // Bijective homomorphism from the first graph onto the second; throws
+        // if they are not isomorphic
+        static Homomorphism findIsomorphism(Graph&, Graph&);
+
+        // Canonical hash of every graph, split across threads
+        static std::vector<uint64_t> hashAll(std::vector<Graph>&, size_t threads = 1);
+
+    };
+
+}
+
+#endif //GRAPPH_CANONICALFORM_H
@@ -0,0 +1,168 @@
+#ifndef GRAPPH_COLUMNARFEATUREGRAPH_H
+#define GRAPPH_COLUMNARFEATUREGRAPH_H
+
+#include "Buffer.h"
+#include "CompactGraph.h"
+#include "FeatureGraph.h"
+#include "Parallel.h"
+#include "Range.h"
+
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace grapph {
+
+    // Frozen FeatureGraph with state held in columns instead of maps. The
+    // structure is a CompactGraph; vertex states sit in a vector indexed by
+    // vertex position, edge states in a vector indexed by edge id (the rank of
+    // the edge in sorted order), and every adjacency slot carries the id of
+    // its edge. Scans over all states stream one contiguous array, and the
+    // state of a neighbor's edge is one indirection away from the row walk.
+    // Columns may be borrowed from a mapped Snapshot file instead of owned.
+    template <typename V, typename E>
+    class ColumnarFeatureGraph {
+
+        friend class Snapshot;
+
+    public:
+
+        typedef Range<const size_t*> id_view_t;
+
+    private:
+
+        CompactGraph graph;
+
+        Buffer<V> vertex_states;
+        Buffer<E> edge_states;
+        Buffer<edge_t> edge_list;
+
+        // Edge id of every adjacency slot of the CompactGraph
+        Buffer<size_t> slot_edges;
+
+        size_t validate(vertex_t vertex) const {
+            size_t position = graph.getIndex().indexOf(vertex);
+            if ( position == VertexIndex::npos ) {
+                std::stringstream ss;
+                ss << "Vertex " << vertex << " not found in graph";
+                throw std::invalid_argument(ss.str());
+            }
+
+            return position;
+        }
+
+        // Adopt columns that already match the graph
+        ColumnarFeatureGraph(CompactGraph graph, Buffer<V> vertex_states, Buffer<E> edge_states,
+                             Buffer<edge_t> edge_list, Buffer<size_t> slot_edges)
+        : graph(std::move(graph)), vertex_states(std::move(vertex_states)), edge_states(std::move(edge_states)),
+          edge_list(std::move(edge_list)), slot_edges(std::move(slot_edges)) {}
+
+    public:
+
+        ColumnarFeatureGraph() = default;
+
+        explicit ColumnarFeatureGraph(FeatureGraph<V, E> & source) : graph(source) {
+            // Both state maps iterate in the same order as positions and edge ids
+            std::vector<V> vertex_column;
+            vertex_column.reserve(graph.getNumVertices());
+            for ( const std::pair<const vertex_t, V> & pair : source.viewVertexStates() ) {
+                vertex_column.push_back(pair.second);
+            }
+            std::vector<E> edge_column;
+            std::vector<edge_t> edges;
+            edge_column.reserve(graph.getNumEdges());
+            edges.reserve(graph.getNumEdges());
+            for ( const std::pair<const edge_t, E> & pair : source.viewEdgeWeights() ) {
+                edges.push_back(pair.first);
+                edge_column.push_back(pair.second);
+            }
+
+            // Sorted edges reach each row in increasing neighbor order, so a
+            // cursor per row assigns slots without searching
+            const VertexIndex & index = graph.getIndex();
+            std::vector<size_t> cursor;
+            cursor.reserve(index.size());
+            for ( vertex_t vertex : graph.viewVertices() ) { cursor.push_back(graph.getFirstSlot(vertex)); }
+
+            std::vector<size_t> slots(graph.getNumSlots());
+            for ( size_t id = 0; id < edges.size(); id++ ) {
+                const edge_t & edge = edges[id];
+                slots[cursor[index.indexOf(edge.first)]++] = id;
+                if ( edge.first != edge.second ) { slots[cursor[index.indexOf(edge.second)]++] = id; }
+            }
+
+            vertex_states = std::move(vertex_column);
+            edge_states = std::move(edge_column);
+            edge_list = std::move(edges);
+            slot_edges = std::move(slots);
+        }
+
+        const CompactGraph& getGraph() const { return graph; }
+
+        size_t getNumVertices() const { return graph.getNumVertices(); }
+        size_t getNumEdges() const { return graph.getNumEdges(); }
+
+        V getVertexState(vertex_t vertex) const { return vertex_states[validate(vertex)]; }
+        void updateVertex(vertex_t vertex, V state) { vertex_states[validate(vertex)] = state; }
+
+        // Id of an edge in the edge columns; throws if it is not in the graph
+        size_t getEdgeId(edge_t edge) const {
+            size_t slot = graph.slotOf(edge.first, edge.second);
+            if ( slot == VertexIndex::npos ) {
+                std::stringstream ss;
+                ss << "Edge (" << edge.first << ", " << edge.second << ") not in graph";
+                throw std::invalid_argument(ss.str());
+            }
+            return slot_edges[slot];
+        }
+
+        E getEdgeState(edge_t edge) const { return edge_states[getEdgeId(edge)]; }
+        void updateEdge(edge_t edge, E state) { edge_states[getEdgeId(edge)] = state; }
+
+        // Columns; entry i of the vertex column belongs to the i-th smallest
+        // vertex id, entry i of the edge columns to edge id i
+        const Buffer<V>& viewVertexStates() const { return vertex_states; }
+        const Buffer<E>& viewEdgeStates() const { return edge_states; }
+        const Buffer<edge_t>& viewEdgeList() const { return edge_list; }
+
+        // Edge ids aligned with viewNeighbors of the same vertex
+        id_view_t viewIncidentEdges(vertex_t vertex) const {
+            size_t first = graph.getFirstSlot(vertex);
+            size_t degree = graph.getDegree(vertex);
+
+            return id_view_t(slot_edges.data() + first, slot_edges.data() + first + degree, degree);
+        }
+
+        // Apply fn to every state in place, over contiguous storage
+        template <typename Function>
+        void transformVertexStates(Function fn, size_t threads = 1) {
+            parallelFor(0, vertex_states.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { vertex_states[i] = fn(vertex_states[i]); }
+            });
+        }
+
+        template <typename Function>
+        void transformEdgeStates(Function fn, size_t threads = 1) {
+            parallelFor(0, edge_states.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { edge_states[i] = fn(edge_states[i]); }
+            });
+        }
+
+        FeatureGraph<V, E> thaw() const {
+            std::vector<std::pair<vertex_t, V>> vertices;
+            vertices.reserve(vertex_states.size());
+            const Buffer<vertex_t> & ids = graph.getIndex().getIds();
+            for ( size_t i = 0; i < ids.size(); i++ ) { vertices.push_back({ ids[i], vertex_states[i] }); }
+
+            std::vector<std::pair<edge_t, E>> edges;
+            edges.reserve(edge_states.size());
+            for ( size_t id = 0; id < edge_list.size(); id++ ) { edges.push_back({ edge_list[id], edge_states[id] }); }
+
+            return FeatureGraph<V, E>(vertices, edges);
+        }
+
+    };
+
+}
+
+#endif //GRAPPH_COLUMNARFEATUREGRAPH_H
@@ -0,0 +1,81 @@
+#ifndef GRAPPH_COMPACTGRAPH_H
+#define GRAPPH_COMPACTGRAPH_H
+
+#include "Buffer.h"
+#include "Graph.h"
+#include "Range.h"
+#include "VertexIndex.h"
+
+#include <set>
+#include <vector>
+
+namespace grapph {
+
+    // Immutable compressed-sparse-row snapshot of a Graph. Row i of the neighbor
+    // array holds the sorted neighbors of the i-th smallest vertex id. The
+    // arrays may be borrowed from a mapped Snapshot file instead of owned.
+    class CompactGraph {
+
+        friend class GraphBuilder;
+        friend class Snapshot;
+
+    public:
+
+        typedef Range<const vertex_t*> view_t;
+
+    private:
+
+        VertexIndex index;
+
+        Buffer<size_t> offsets;
+        Buffer<vertex_t> neighbors;
+
+        size_t num_edges = 0;
+
+        size_t validate(vertex_t) const;
+
+        // Build straight from sorted, unique vertices and sorted, unique, ordered edges
+        CompactGraph(const std::vector<vertex_t>&, const std::vector<edge_t>&);
+        // Adopt arrays that already hold a valid layout
+        CompactGraph(VertexIndex, Buffer<size_t> offsets, Buffer<vertex_t> neighbors, size_t num_edges);
+
+    public:
+
+        CompactGraph() = default;
+        explicit CompactGraph(Graph&);
+
+        bool adjacent(vertex_t, vertex_t) const;
+        bool incident(vertex_t, edge_t) const;
+
+        std::set<vertex_t> getNeighbors(vertex_t) const;
+        size_t getDegree(vertex_t) const;
+
+        std::set<vertex_t> getVertices() const;
+        std::set<edge_t> getEdges() const;
+
+        size_t getNumVertices() const { return index.size(); }
+        size_t getNumEdges() const { return num_edges; }
+
+        const VertexIndex& getIndex() const { return index; }
+
+        // Whether the arrays are borrowed from a mapped snapshot
+        bool isMapped() const { return neighbors.isBorrowed(); }
+
+        // Read-only views of the sorted rows and vertex ids; no copies
+        view_t viewNeighbors(vertex_t) const;
+        view_t viewVertices() const;
+
+        // Positions in the neighbor array, for data kept in arrays aligned
+        // with it; a vertex's row occupies getDegree slots from its first slot
+        size_t getNumSlots() const { return neighbors.size(); }
+        size_t getFirstSlot(vertex_t) const;
+        // Slot of the second vertex in the first's row, or VertexIndex::npos
+        size_t slotOf(vertex_t, vertex_t) const;
+
+        Graph thaw() const;
+
+    };
+
+}
+
+#endif //GRAPPH_COMPACTGRAPH_H
@@ -0,0 +1,58 @@
+#ifndef GRAPPH_COMPONENTS_H
+#define GRAPPH_COMPONENTS_H
+
+#include "CompactGraph.h"
+#include "DenseGraph.h"
+#include "Graph.h"
+#include "VertexIndex.h"
+
+#include <vector>
+
+namespace grapph {
+
+    // Connected components of a graph at one point in time, computed in
+    // parallel with Afforest: every vertex first links to a couple of its
+    // neighbors, which usually assembles the giant component already; a
+    // sample then names that component, and only vertices outside it go
+    // through the rest of their rows. Links hook the larger of two roots
+    // under the smaller with a compare-and-swap, so every component ends up
+    // labeled by its smallest vertex id.
+    class Components {
+
+    private:
+
+        VertexIndex index;
+
+        // Position of the smallest vertex in each position's component
+        std::vector<size_t> labels;
+
+        size_t num_components = 0;
+
+        size_t validate(vertex_t) const;
+
+        template <typename G>
+        void compute(const G&, size_t threads);
+
+    public:
+
+        // 0 threads means one per hardware thread
+        explicit Components(const Graph&, size_t threads = 1);
+        explicit Components(const CompactGraph&, size_t threads = 1);
+        explicit Components(const DenseGraph&, size_t threads = 1);
+
+        size_t getNumComponents() const { return num_components; }
+
+        // Smallest vertex id in the vertex's component
+        vertex_t getComponent(vertex_t) const;
+        bool connected(vertex_t, vertex_t) const;
+
+        // Vertices of the component, in increasing order
+        std::vector<vertex_t> getMembers(vertex_t) const;
+        // Smallest vertex id of each component, in increasing order
+        std::vector<vertex_t> getRepresentatives() const;
+
+    };
+
+}
+
+#endif //GRAPPH_COMPONENTS_H
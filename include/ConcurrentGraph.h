@@ -0,0 +1,187 @@
+#ifndef GRAPPH_CONCURRENTGRAPH_H
+#define GRAPPH_CONCURRENTGRAPH_H
+
+#include "Graph.h"
+#include "Range.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace grapph {
+
+    // Graph for many reader threads and one writer at a time. Every version
+    // is immutable: a radix trie over vertex ids whose leaves point at sorted
+    // neighbor blocks. A write copies only the blocks it changes and the trie
+    // path above them, then publishes the new version with a single atomic
+    // store, so readers never wait for writers or for each other.
+    //
+    // Memory a write unlinks is reclaimed by epochs: a view announces the
+    // global epoch in a per-thread slot while it is open, and unlinked memory
+    // is freed once every open view announced a later epoch. Taking a view
+    // writes nothing that other threads write, so reads scale with cores.
+    class ConcurrentGraph {
+
+    public:
+
+        typedef Range<const vertex_t*> view_t;
+
+        // Each trie level resolves this many bits of a vertex id
+        static const size_t FANOUT_BITS = 6;
+        static const size_t FANOUT = size_t(1) << FANOUT_BITS;
+
+    private:
+
+        struct Block {
+            std::vector<vertex_t> neighbors;
+        };
+
+        // Inner nodes point at nodes one level down, leaves at blocks; an
+        // absent vertex has no block
+        struct Node {
+            union {
+                const Node * children[FANOUT];
+                const Block * blocks[FANOUT];
+            };
+            Node() : children() {}
+        };
+
+        struct Version {
+            const Node * root = nullptr;
+            // Levels in the trie; it covers ids below FANOUT^height
+            size_t height = 0;
+            size_t num_vertices = 0;
+            size_t num_edges = 0;
+            uint64_t number = 0;
+        };
+
+        // Memory unlinked by a write, kept until no view can reach it
+        struct Retired {
+            enum Kind { VERSION, NODE, BLOCK };
+            Kind kind;
+            const void * pointer;
+            uint64_t epoch;
+        };
+
+        class Draft;
+
+        std::atomic<const Version*> current;
+        // Number of the current version, readable without pinning it
+        std::atomic<uint64_t> latest;
+
+        std::mutex writer;
+        std::vector<Retired> retired;
+
+        static const Block * find(const Node * root, size_t height, vertex_t);
+        static void free(const Node*, size_t height);
+        static void collect(const Node*, size_t height, vertex_t prefix, std::vector<vertex_t>&);
+        static void dispose(const Retired&);
+
+        void publish(Draft&);
+        void reclaim();
+
+    public:
+
+        // A consistent, read-only state of the graph. Cheap to take; it pins
+        // the memory of its version until destroyed, so keep it short-lived.
+        // Destroy it on the thread that took it, before the graph.
+        class View {
+
+            friend class ConcurrentGraph;
+
+        private:
+
+            const Version * version;
+
+            explicit View(const ConcurrentGraph&);
+
+        public:
+
+            View(View&&) noexcept;
+            View& operator=(View&&) = delete;
+            View(const View&) = delete;
+            ~View();
+
+            uint64_t getVersion() const { return version->number; }
+            size_t getNumVertices() const { return version->num_vertices; }
+            size_t getNumEdges() const { return version->num_edges; }
+
+            bool hasVertex(vertex_t) const;
+            bool hasEdge(vertex_t, vertex_t) const;
+            bool adjacent(vertex_t, vertex_t) const;
+
+            // Sorted neighbors; valid while the view is
+            view_t viewNeighbors(vertex_t) const;
+            size_t getDegree(vertex_t) const;
+
+            // Vertices in id order
+            std::vector<vertex_t> getVertices() const;
+            Graph toGraph() const;
+
+        };
+
+        // Several updates published as one version. Holds the writer lock
+        // until committed or destroyed; uncommitted updates are dropped.
+        class Batch {
+
+            friend class ConcurrentGraph;
+
+        private:
+
+            ConcurrentGraph & graph;
+            std::unique_lock<std::mutex> lock;
+            std::unique_ptr<Draft> draft;
+
+            explicit Batch(ConcurrentGraph&);
+
+        public:
+
+            Batch(Batch&&) noexcept;
+            ~Batch();
+
+            vertex_t addVertex(vertex_t);
+            void removeVertex(vertex_t);
+
+            edge_t addEdge(vertex_t, vertex_t);
+            edge_t addEdge(edge_t);
+            void removeEdge(edge_t);
+
+            bool hasVertex(vertex_t) const;
+            bool hasEdge(edge_t) const;
+
+            // Publish everything added so far; the batch is empty afterwards
+            uint64_t commit();
+
+        };
+
+        ConcurrentGraph();
+        explicit ConcurrentGraph(Graph&);
+        ~ConcurrentGraph();
+
+        ConcurrentGraph(const ConcurrentGraph&) = delete;
+        ConcurrentGraph& operator=(const ConcurrentGraph&) = delete;
+
+        View view() const { return View(*this); }
+        Batch batch() { return Batch(*this); }
+
+        // Each publishes a version of its own; writers queue on a lock
+        vertex_t addVertex(vertex_t);
+        void removeVertex(vertex_t);
+
+        edge_t addEdge(vertex_t, vertex_t);
+        edge_t addEdge(edge_t);
+        void removeEdge(edge_t);
+
+        uint64_t getVersion() const { return latest.load(); }
+
+        // Unlinked allocations still waiting for views to close
+        size_t getNumRetired();
+
+    };
+
+}
+
+#endif //GRAPPH_CONCURRENTGRAPH_H
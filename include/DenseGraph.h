@@ -0,0 +1,160 @@
+#ifndef GRAPPH_DENSEGRAPH_H
+#define GRAPPH_DENSEGRAPH_H
+
+#include "Bitset.h"
+#include "Graph.h"
+#include "Range.h"
+#include "VertexIndex.h"
+
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace grapph {
+
+    // Graph over a fixed vertex set stored as a symmetric bit matrix: row i
+    // holds bit j when the i-th and j-th smallest vertex ids are adjacent.
+    // It takes n^2 bits however many edges there are, against well over a
+    // hundred bytes per edge in Graph's sets. Adjacency is one bit test,
+    // degrees are popcounts, and neighborhood operations run a word (64
+    // vertices) at a time. Edges can be added and removed; the vertex set is
+    // fixed at construction. viewVertices and viewNeighbors follow Graph's
+    // views, so the traversal, component and triangle algorithms take it too.
+    class DenseGraph {
+
+    public:
+
+        // Walks the set bits of a row, yielding neighbor ids in increasing order
+        class NeighborIterator {
+
+        private:
+
+            const Bitset * row;
+            const VertexIndex * index;
+            size_t position;
+
+        public:
+
+            typedef std::forward_iterator_tag iterator_category;
+            typedef vertex_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const vertex_t* pointer;
+            typedef vertex_t reference;
+
+            NeighborIterator(const Bitset * row, const VertexIndex * index, size_t position)
+            : row(row), index(index), position(position) {}
+
+            vertex_t operator*() const { return index->idOf(position); }
+
+            NeighborIterator& operator++() {
+                position = row->findNext(position);
+                return *this;
+            }
+
+            NeighborIterator operator++(int) { NeighborIterator copy = *this; ++*this; return copy; }
+
+            bool operator==(const NeighborIterator & other) const { return position == other.position; }
+            bool operator!=(const NeighborIterator & other) const { return position != other.position; }
+
+        };
+
+        // Neighbors of one row; the first set bit and the popcount are only
+        // found when begin and size are called
+        class NeighborView {
+
+        private:
+
+            const Bitset * row;
+            const VertexIndex * index;
+
+        public:
+
+            NeighborView(const Bitset * row, const VertexIndex * index) : row(row), index(index) {}
+
+            NeighborIterator begin() const { return NeighborIterator(row, index, row->findFirst()); }
+            NeighborIterator end() const { return NeighborIterator(row, index, Bitset::npos); }
+
+            size_t size() const { return row->count(); }
+            bool empty() const { return row->findFirst() == Bitset::npos; }
+
+        };
+
+        typedef Range<const vertex_t*> view_t;
+        typedef NeighborView neighbor_view_t;
+
+    private:
+
+        VertexIndex index;
+
+        std::vector<Bitset> rows;
+
+        size_t num_edges = 0;
+
+        size_t validate(vertex_t) const;
+
+        // Positions of a set of vertices, as a bitset over rows
+        Bitset mask(const std::vector<vertex_t>&) const;
+
+    public:
+
+        DenseGraph() = default;
+        explicit DenseGraph(Graph&);
+        // Vertices with no edges; ids are taken in sorted order
+        explicit DenseGraph(const std::set<vertex_t>&);
+
+        // Whether at least a tenth of the vertex pairs are edges, past which
+        // row scans cost no more than walking the sparse neighbor sets
+        static bool prefersDense(size_t num_vertices, size_t num_edges);
+
+        bool hasVertex(vertex_t vertex) const { return index.contains(vertex); }
+        bool hasEdge(vertex_t, vertex_t) const;
+        bool hasEdge(edge_t edge) const { return hasEdge(edge.first, edge.second); }
+
+        Status tryAddEdge(vertex_t, vertex_t);
+        Status tryAddEdge(edge_t edge) { return tryAddEdge(edge.first, edge.second); }
+        Status tryRemoveEdge(edge_t);
+
+        edge_t addEdge(vertex_t, vertex_t);
+        edge_t addEdge(edge_t edge) { return addEdge(edge.first, edge.second); }
+        void removeEdge(edge_t);
+
+        bool adjacent(vertex_t, vertex_t) const;
+        bool incident(vertex_t, edge_t) const;
+
+        std::set<vertex_t> getNeighbors(vertex_t) const;
+        size_t getDegree(vertex_t) const;
+
+        std::set<vertex_t> getVertices() const;
+        std::set<edge_t> getEdges() const;
+
+        size_t getNumVertices() const { return index.size(); }
+        size_t getNumEdges() const { return num_edges; }
+
+        const VertexIndex& getIndex() const { return index; }
+
+        view_t viewVertices() const;
+        // Neighbors in increasing order, read off the row in place
+        neighbor_view_t viewNeighbors(vertex_t) const;
+        // Row of a vertex over positions; map them back with getIndex
+        const Bitset& viewRow(vertex_t) const;
+
+        // Word-parallel neighborhood operations
+        size_t countCommonNeighbors(vertex_t, vertex_t) const;
+        std::set<vertex_t> getCommonNeighbors(vertex_t, vertex_t) const;
+        // Vertices adjacent to at least one of / every one of the given ones
+        Bitset neighborhoodUnion(const std::vector<vertex_t>&) const;
+        Bitset neighborhoodIntersection(const std::vector<vertex_t>&) const;
+
+        // Bulk row operations; each keeps the matrix symmetric
+        void connectAll(vertex_t, const std::vector<vertex_t>&);
+        void isolate(vertex_t);
+        // Same vertices, with exactly the loop-free pairs that are not edges
+        DenseGraph complement() const;
+
+        Graph thaw() const;
+
+    };
+
+}
+
+#endif //GRAPPH_DENSEGRAPH_H
@@ -1,37 +1,137 @@
 #ifndef GRAPPH_FEATUREGRAPH_H
 #define GRAPPH_FEATUREGRAPH_H
 
-#include <vector>
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory_resource>
+#include <mutex>
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "Graph.h"
+#include "Instrumentation.h"
+#include "Parallel.h"
 
 namespace grapph {
 
     template <typename V, typename E>
     class FeatureGraph : public Graph {
 
+    public:
+
+        typedef std::function<V(vertex_t)> vertex_auto_state_t;
+        typedef std::function<E(edge_t)> edge_auto_state_t;
+
+        // State maps allocate from the graph's memory resource
+        typedef std::pmr::map<vertex_t, V> vertex_states_t;
+        typedef std::pmr::map<edge_t, E> edge_states_t;
+
     private:
 
-        std::map<vertex_t, V> vertex_state;
-        std::map<edge_t, E> edge_state;
+        // In lazy mode a vertex or edge added through its auto state has no
+        // entry here until first read, so the maps are filled from const reads
+        mutable vertex_states_t vertex_state;
+        mutable edge_states_t edge_state;
+
+        // Serializes those fills, so const reads of a lazy graph stay safe to
+        // share between threads. Auto states run under it and must not read
+        // this graph. Copies get a mutex of their own.
+        struct FillMutex {
+            std::mutex mutex;
+            FillMutex() = default;
+            FillMutex(const FillMutex&) {}
+            FillMutex& operator=(const FillMutex&) { return *this; }
+        };
+        mutable FillMutex fill_mutex;
+
+        std::unique_lock<std::mutex> lockFills(bool lazy) const {
+            std::unique_lock<std::mutex> lock(fill_mutex.mutex, std::defer_lock);
+            if ( lazy ) { lock.lock(); }
+            return lock;
+        }
+
+        vertex_auto_state_t vertex_auto_state;
+        edge_auto_state_t edge_auto_state;
 
-        V (*vertex_auto_state)(vertex_t) = defaultVertexState;
-        E (*edge_auto_state)(edge_t) = defaultEdgeState;
+        bool lazy_vertex_states = false;
+        bool lazy_edge_states = false;
 
-        static V defaultVertexState(vertex_t u) {
-            throw std::logic_error("No vertex auto state defined");
+        static edge_t order(edge_t edge) {
+            if ( edge.first > edge.second ) { return { edge.second, edge.first }; }
+            return edge;
         }
 
-        static E defaultEdgeState(edge_t uw) {
-            throw std::logic_error("No edge auto state defined");
+        // State of a vertex or ordered edge known to be in the graph,
+        // generating and memoizing it if it is still pending
+        V & vertexState(vertex_t u) const {
+            std::unique_lock<std::mutex> lock = lockFills(lazy_vertex_states);
+            auto it = vertex_state.lower_bound(u);
+            if ( it == vertex_state.end() || it->first != u ) {
+                it = vertex_state.emplace_hint(it, u, vertex_auto_state(u));
+            }
+            return it->second;
+        }
+
+        E & edgeState(edge_t edge) const {
+            std::unique_lock<std::mutex> lock = lockFills(lazy_edge_states);
+            auto it = edge_state.lower_bound(edge);
+            if ( it == edge_state.end() || it->first != edge ) {
+                it = edge_state.emplace_hint(it, edge, edge_auto_state(edge));
+            }
+            return it->second;
+        }
+
+        // Overwrite the state of a vertex or ordered edge known to be in the
+        // graph; a pending state is simply replaced, never generated
+        void storeVertexState(vertex_t u, V t) {
+            auto it = vertex_state.lower_bound(u);
+            if ( it != vertex_state.end() && it->first == u ) { it->second = t; }
+            else { vertex_state.emplace_hint(it, u, t); }
+        }
+
+        void storeEdgeState(edge_t edge, E state) {
+            auto it = edge_state.lower_bound(edge);
+            if ( it != edge_state.end() && it->first == edge ) { it->second = state; }
+            else { edge_state.emplace_hint(it, edge, state); }
+        }
+
+        bool vertexStatesPending() const { return vertex_state.size() < Graph::viewVertices().size(); }
+        bool edgeStatesPending() const { return edge_state.size() < Graph::viewEdges().size(); }
+
+        // Generate every pending state; structure and state maps are both
+        // sorted, so one lockstep walk finds the gaps
+        void materializeVertexStates() const {
+            std::unique_lock<std::mutex> lock = lockFills(lazy_vertex_states);
+            if ( vertex_state.size() == Graph::viewVertices().size() ) { return; }
+
+            auto it = vertex_state.begin();
+            for ( vertex_t u : Graph::viewVertices() ) {
+                if ( it != vertex_state.end() && it->first == u ) { it++; }
+                else { vertex_state.emplace_hint(it, u, vertex_auto_state(u)); }
+            }
+        }
+
+        void materializeEdgeStates() const {
+            std::unique_lock<std::mutex> lock = lockFills(lazy_edge_states);
+            if ( edge_state.size() == Graph::viewEdges().size() ) { return; }
+
+            auto it = edge_state.begin();
+            for ( const edge_t & edge : Graph::viewEdges() ) {
+                if ( it != edge_state.end() && it->first == edge ) { it++; }
+                else { edge_state.emplace_hint(it, edge, edge_auto_state(edge)); }
+            }
         }
 
     protected:
 
-        void validate(edge_t edge) {
-            if ( Graph::getEdges().count(edge) == 0
-                || edge_state.count(edge) == 0 ) {
+        void validate(edge_t edge) const {
+            // Only ordered keys name an edge's state
+            if ( !Graph::hasEdge(edge)
+                || edge.first > edge.second ) {
+                GRAPPH_INSTRUMENT_VALIDATION_FAILURE();
                 std::stringstream ss;
                 ss << "Edge (" << edge.first << ", " << edge.second
                     << ") not in graph";
@@ -39,32 +139,259 @@ namespace grapph {
             }
         }
 
+        // Build the exception the throwing API has always raised for a failed try*
+        static void raise(Status status, vertex_t u) {
+            std::stringstream ss;
+            switch ( status ) {
+                case Status::NO_AUTO_STATE:
+                    throw std::logic_error("No vertex auto state defined");
+                case Status::VERTEX_EXISTS:
+                    ss << "Vertex " << u << " already in graph";
+                    break;
+                default:
+                    ss << "Vertex " << u << " not in graph";
+                    break;
+            }
+            throw std::invalid_argument(ss.str());
+        }
+
+        void raise(Status status, edge_t edge) {
+            std::stringstream ss;
+            switch ( status ) {
+                case Status::NO_AUTO_STATE:
+                    throw std::logic_error("No edge auto state defined");
+                case Status::VERTEX_NOT_FOUND:
+                    Graph::validate(edge.first);
+                    Graph::validate(edge.second);
+                    break;
+                case Status::EDGE_EXISTS:
+                    throw std::invalid_argument("Edge already added");
+                default:
+                    break;
+            }
+            ss << "Edge (" << edge.first << ", " << edge.second
+                << ") not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        // Look up keys 0..count-1 before anything is read or written; fail is
+        // called with the first missing key in input order. Sorted batches
+        // covering much of the map are merged against it in one forward walk,
+        // others are searched key by key across threads.
+        template <typename Map, typename Key>
+        static std::vector<decltype(std::declval<Map&>().end())>
+        findAll(Map & map, size_t count, size_t threads, Key key, const std::function<void(size_t)> & fail) {
+            typedef decltype(std::declval<Map&>().end()) iterator_t;
+            std::vector<iterator_t> found(count, map.end());
+
+            bool sorted = true;
+            for ( size_t i = 1; i < count && sorted; i++ ) { sorted = !(key(i) < key(i - 1)); }
+            size_t probes = 1;
+            for ( size_t span = map.size(); span > 1; span >>= 1 ) { probes++; }
+
+            size_t missing = count;
+            if ( sorted && count * probes > map.size() ) {
+                iterator_t it = map.begin();
+                for ( size_t i = 0; i < count; i++ ) {
+                    while ( it != map.end() && it->first < key(i) ) { it++; }
+                    if ( it == map.end() || key(i) < it->first ) { missing = i; break; }
+                    found[i] = it;
+                }
+            } else {
+                std::vector<size_t> first_missing(resolveThreads(threads), count);
+                parallelFor(0, count, threads, [&](size_t lo, size_t hi, size_t worker) {
+                    for ( size_t i = lo; i < hi; i++ ) {
+                        found[i] = map.find(key(i));
+                        if ( found[i] == map.end() ) { first_missing[worker] = i; return; }
+                    }
+                });
+                missing = *std::min_element(first_missing.begin(), first_missing.end());
+            }
+
+            if ( missing != count ) { fail(missing); }
+            return found;
+        }
+
+        // Copy each slot's state into out. vector<bool> packs neighbouring
+        // elements into one word, so it is filled on a single thread.
+        template <typename Iterator, typename State>
+        static void gatherStates(const std::vector<Iterator> & slots, std::vector<State> & out, size_t threads) {
+            out.resize(slots.size());
+            if ( std::is_same<State, bool>::value ) { threads = 1; }
+            parallelFor(0, slots.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { out[i] = slots[i]->second; }
+            });
+        }
+
+        template <typename Key, typename Value>
+        static void checkBatch(const std::vector<Key> & keys, const std::vector<Value> & values) {
+            if ( keys.size() != values.size() ) {
+                std::stringstream ss;
+                ss << "Batch has " << keys.size() << " keys but " << values.size() << " values";
+                throw std::invalid_argument(ss.str());
+            }
+        }
+
     public:
 
         FeatureGraph() = default;
 
-        FeatureGraph(std::vector<std::pair<vertex_t, V>> vertices, std::vector<std::pair<edge_t, E>> edges)
-        : Graph() {
-            // Add each vertex
-            for ( std::pair<vertex_t, V> pair : vertices ) {
-                addVertex(pair.first, pair.second);
+        // Structure and states allocate from the resource, which must outlive
+        // the graph
+        explicit FeatureGraph(std::pmr::memory_resource * resource)
+        : Graph(resource), vertex_state(resource), edge_state(resource) {}
+
+        FeatureGraph(const FeatureGraph & other, std::pmr::memory_resource * resource)
+        : Graph(other, resource), vertex_state(other.vertex_state, resource), edge_state(other.edge_state, resource),
+          vertex_auto_state(other.vertex_auto_state), edge_auto_state(other.edge_auto_state),
+          lazy_vertex_states(other.lazy_vertex_states), lazy_edge_states(other.lazy_edge_states) {}
+
+        FeatureGraph(std::vector<std::pair<vertex_t, V>> vertices, std::vector<std::pair<edge_t, E>> edges,
+                     size_t threads = 1, std::pmr::memory_resource * resource = std::pmr::get_default_resource())
+        : Graph(resource), vertex_state(resource), edge_state(resource) {
+            // Order each edge, then sort both lists by key
+            parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    edge_t & edge = edges[i].first;
+                    if ( edge.first > edge.second ) { edge = { edge.second, edge.first }; }
+                }
+            });
+            parallelSort(vertices.begin(), vertices.end(),
+                         [](const std::pair<vertex_t, V> & a, const std::pair<vertex_t, V> & b) {
+                             return a.first < b.first;
+                         }, threads);
+            parallelSort(edges.begin(), edges.end(),
+                         [](const std::pair<edge_t, E> & a, const std::pair<edge_t, E> & b) {
+                             return a.first < b.first;
+                         }, threads);
+
+            // Check the whole input before touching the graph
+            std::vector<vertex_t> vertex_list;
+            vertex_list.reserve(vertices.size());
+            for ( const std::pair<vertex_t, V> & pair : vertices ) { vertex_list.push_back(pair.first); }
+            std::vector<edge_t> edge_list;
+            edge_list.reserve(edges.size());
+            for ( const std::pair<edge_t, E> & pair : edges ) { edge_list.push_back(pair.first); }
+
+            std::vector<std::string> problems = checkVertexList(vertex_list, threads);
+            std::vector<std::string> edge_problems = checkEdgeList(vertex_list, edge_list, threads);
+            problems.insert(problems.end(), edge_problems.begin(), edge_problems.end());
+            throwIfInvalid(problems);
+
+            // Fill structure and state in one sorted pass each
+            assign(vertex_list, edge_list);
+            for ( std::pair<vertex_t, V> & pair : vertices ) {
+                vertex_state.emplace_hint(vertex_state.end(), pair.first, std::move(pair.second));
+            }
+            for ( std::pair<edge_t, E> & pair : edges ) {
+                edge_state.emplace_hint(edge_state.end(), pair.first, std::move(pair.second));
+            }
+        }
+
+        Status tryAddVertex(vertex_t u) override {
+            if ( Graph::hasVertex(u) ) { return Status::VERTEX_EXISTS; }
+            if ( !vertex_auto_state ) { return Status::NO_AUTO_STATE; }
+
+            // Lazy states are generated on first read
+            if ( lazy_vertex_states ) { return Graph::tryAddVertex(u); }
+            return tryAddVertex(u, vertex_auto_state(u));
+        }
+
+        Status tryAddVertex(vertex_t u, V t) {
+            Status status = Graph::tryAddVertex(u);
+            if ( status == Status::SUCCESS ) { vertex_state[u] = t; }
+            return status;
+        }
+
+        Status tryRemoveVertex(vertex_t u) override {
+            if ( !Graph::hasVertex(u) ) { return Status::VERTEX_NOT_FOUND; }
+
+            // Remove edge weights for edges u is incident to; the
+            // structural edges go with the vertex below
+            for ( vertex_t neighbor : Graph::viewNeighbors(u) ) {
+                edge_state.erase(order({ u, neighbor }));
             }
 
-            // Add each edge
-            for ( std::pair<edge_t, E> pair : edges ) {
-                addEdge(pair.first, pair.second);
+            // Remove vertex u
+            vertex_state.erase(u);
+            return Graph::tryRemoveVertex(u);
+        }
+
+        Status tryAddEdge(vertex_t u, vertex_t w) override {
+            return tryAddEdge({u, w});
+        }
+
+        Status tryAddEdge(edge_t edge) override {
+            edge = order(edge);
+
+            // Structural problems take precedence over a missing auto state
+            if ( !Graph::hasVertex(edge.first) || !Graph::hasVertex(edge.second) ) {
+                return Status::VERTEX_NOT_FOUND;
             }
+            if ( Graph::hasEdge(edge) ) { return Status::EDGE_EXISTS; }
+            if ( !edge_auto_state ) { return Status::NO_AUTO_STATE; }
+
+            if ( lazy_edge_states ) { return Graph::tryAddEdge(edge); }
+            return tryAddEdge(edge, edge_auto_state(edge));
+        }
+
+        Status tryAddEdge(edge_t edge, E state) {
+            edge = order(edge);
+
+            Status status = Graph::tryAddEdge(edge);
+            if ( status == Status::SUCCESS ) { edge_state[edge] = state; }
+            return status;
+        }
+
+        Status tryRemoveEdge(edge_t edge) override {
+            edge = order(edge);
 
+            Status status = Graph::tryRemoveEdge(edge);
+            if ( status == Status::SUCCESS ) { edge_state.erase(edge); }
+            return status;
+        }
+
+        Status tryUpdateVertex(vertex_t u, V t) {
+            if ( !Graph::hasVertex(u) ) { return Status::VERTEX_NOT_FOUND; }
+
+            storeVertexState(u, t);
+            return Status::SUCCESS;
+        }
+
+        Status tryUpdateEdge(edge_t edge, E state) {
+            if ( edge.first > edge.second || !Graph::hasEdge(edge) ) { return Status::EDGE_NOT_FOUND; }
+
+            storeEdgeState(edge, state);
+            return Status::SUCCESS;
+        }
+
+        Status tryGetVertexState(vertex_t u, V & out) const {
+            if ( !Graph::hasVertex(u) ) { return Status::VERTEX_NOT_FOUND; }
+
+            out = vertexState(u);
+            return Status::SUCCESS;
+        }
+
+        Status tryGetEdgeState(edge_t edge, E & out) const {
+            if ( edge.first > edge.second || !Graph::hasEdge(edge) ) { return Status::EDGE_NOT_FOUND; }
+
+            out = edgeState(edge);
+            return Status::SUCCESS;
         }
 
         vertex_t addVertex() override {
-            V state = vertex_auto_state(next_vertex);
-            return addVertex(next_vertex, state);
+            return addVertex(next_vertex);
         }
 
         vertex_t addVertex(vertex_t u) override {
-            V state = vertex_auto_state(u);
-            return addVertex(u, state);
+            GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_VERTEX);
+
+            // An unset auto state is reported before a clash, as it always was
+            if ( !vertex_auto_state ) { raise(Status::NO_AUTO_STATE, u); }
+
+            Status status = tryAddVertex(u);
+            if ( status != Status::SUCCESS ) { raise(status, u); }
+            return u;
         }
 
         vertex_t addVertex(V t) {
@@ -72,47 +399,36 @@ namespace grapph {
         }
 
         vertex_t addVertex(vertex_t u, V t) {
-            vertex_t recent = Graph::addVertex(u);
-            vertex_state[recent] = t;
-            return recent;
+            GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_VERTEX);
+
+            Status status = tryAddVertex(u, t);
+            if ( status != Status::SUCCESS ) { raise(status, u); }
+            return u;
         }
 
         void updateVertex(vertex_t u, V t) {
-            Graph::validate(u);
-            vertex_state[u] = t;
+            if ( tryUpdateVertex(u, t) != Status::SUCCESS ) { Graph::validate(u); }
         }
 
         void removeVertex(vertex_t u) override {
-            // Remove edge weights for edges u is incident to
-            for ( vertex_t neighbor : Graph::getNeighbors(u) ) {
-                // Get edge
-                edge_t incident = { u, neighbor };
-                if ( neighbor < u ) { incident = { neighbor, u }; }
-
-                // Remove edge
-                removeEdge(incident);
-            }
+            GRAPPH_INSTRUMENT_SCOPE(Operation::REMOVE_VERTEX);
 
-            // Remove vertex u
-            Graph::removeVertex(u);
-            vertex_state.erase(u);
+            Status status = tryRemoveVertex(u);
+            if ( status != Status::SUCCESS ) { raise(status, u); }
         }
 
         edge_t addEdge(vertex_t u, vertex_t w) override {
-            edge_t recent = Graph::addEdge(u, w);
-            try {
-                edge_state[recent] = edge_auto_state(recent);
-            } catch ( std::logic_error & e ) {
-                Graph::removeEdge(recent);
-                throw e;  // We need to remove the constructed edge before throwing the error, so we catch and throw again
-            }
-            
-            return recent;
+            return addEdge({u, w});
         }
 
         edge_t addEdge(edge_t edge) override {
-            edge_state[edge] = edge_auto_state(edge);
-            return Graph::addEdge(edge);
+            GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_EDGE);
+
+            edge = order(edge);
+
+            Status status = tryAddEdge(edge);
+            if ( status != Status::SUCCESS ) { raise(status, edge); }
+            return edge;
         }
 
         edge_t addEdge(vertex_t u, vertex_t w, E state) {
@@ -120,30 +436,148 @@ namespace grapph {
         }
 
         edge_t addEdge(edge_t edge, E state) {
-            edge_t recent = Graph::addEdge(edge);
-            edge_state[recent] = state;
-            return recent;
+            GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_EDGE);
+
+            edge = order(edge);
+
+            Status status = tryAddEdge(edge, state);
+            if ( status != Status::SUCCESS ) { raise(status, edge); }
+            return edge;
         }
 
         void updateEdge(edge_t edge, E state) {
-            validate(edge);
-            edge_state[edge] = state;
+            if ( tryUpdateEdge(edge, state) != Status::SUCCESS ) { validate(edge); }
         }
 
         void removeEdge(edge_t edge) override {
-            validate(edge);
-            edge_state.erase(edge);
-            Graph::removeEdge(edge);
+            GRAPPH_INSTRUMENT_SCOPE(Operation::REMOVE_EDGE);
+
+            Status status = tryRemoveEdge(edge);
+            if ( status != Status::SUCCESS ) { raise(status, order(edge)); }
+        }
+
+        // Whole-map getters and views generate any pending lazy states first
+        V getVertexState(vertex_t vertex) { Graph::validate(vertex); return vertexState(vertex); }
+        std::map<vertex_t, V> getVertexStates() {
+            materializeVertexStates();
+            return std::map<vertex_t, V>(vertex_state.begin(), vertex_state.end());
+        }
+        const vertex_states_t& viewVertexStates() const { materializeVertexStates(); return vertex_state; }
+
+        E getEdgeState(edge_t edge) { validate(edge); return edgeState(edge); }
+        std::map<edge_t, E> getEdgeWeights() {
+            materializeEdgeStates();
+            return std::map<edge_t, E>(edge_state.begin(), edge_state.end());
+        }
+        const edge_states_t& viewEdgeWeights() const { materializeEdgeStates(); return edge_state; }
+
+        // Batch counterparts of the calls above: every key is checked before
+        // any state is touched, and lookups can be split across threads.
+        // Writes happen in input order, so a repeated key keeps its last value.
+        // While lazy states are pending, keys are resolved one by one so only
+        // the touched states are ever generated.
+        void updateVertices(const std::vector<vertex_t> & vertices, const std::vector<V> & states,
+                            size_t threads = 1) {
+            checkBatch(vertices, states);
+            if ( vertexStatesPending() ) {
+                for ( vertex_t u : vertices ) { Graph::validate(u); }
+                for ( size_t i = 0; i < vertices.size(); i++ ) { storeVertexState(vertices[i], states[i]); }
+                return;
+            }
+            auto slots = findAll(vertex_state, vertices.size(), threads,
+                                 [&](size_t i) { return vertices[i]; },
+                                 [&](size_t i) { Graph::validate(vertices[i]); });
+            for ( size_t i = 0; i < slots.size(); i++ ) { slots[i]->second = states[i]; }
+        }
+
+        void updateEdges(const std::vector<edge_t> & edges, const std::vector<E> & states, size_t threads = 1) {
+            checkBatch(edges, states);
+            if ( edgeStatesPending() ) {
+                for ( const edge_t & edge : edges ) { validate(order(edge)); }
+                for ( size_t i = 0; i < edges.size(); i++ ) { storeEdgeState(order(edges[i]), states[i]); }
+                return;
+            }
+            auto slots = findAll(edge_state, edges.size(), threads,
+                                 [&](size_t i) { return order(edges[i]); },
+                                 [&](size_t i) { validate(order(edges[i])); });
+            for ( size_t i = 0; i < slots.size(); i++ ) { slots[i]->second = states[i]; }
+        }
+
+        void gatherVertexStates(const std::vector<vertex_t> & vertices, std::vector<V> & out,
+                                size_t threads = 1) {
+            if ( vertexStatesPending() ) {
+                for ( vertex_t u : vertices ) { Graph::validate(u); }
+                out.resize(vertices.size());
+                for ( size_t i = 0; i < vertices.size(); i++ ) { out[i] = vertexState(vertices[i]); }
+                return;
+            }
+            auto slots = findAll(vertex_state, vertices.size(), threads,
+                                 [&](size_t i) { return vertices[i]; },
+                                 [&](size_t i) { Graph::validate(vertices[i]); });
+            gatherStates(slots, out, threads);
+        }
+
+        void gatherEdgeStates(const std::vector<edge_t> & edges, std::vector<E> & out, size_t threads = 1) {
+            if ( edgeStatesPending() ) {
+                for ( const edge_t & edge : edges ) { validate(order(edge)); }
+                out.resize(edges.size());
+                for ( size_t i = 0; i < edges.size(); i++ ) { out[i] = edgeState(order(edges[i])); }
+                return;
+            }
+            auto slots = findAll(edge_state, edges.size(), threads,
+                                 [&](size_t i) { return order(edges[i]); },
+                                 [&](size_t i) { validate(order(edges[i])); });
+            gatherStates(slots, out, threads);
+        }
+
+        // Replace every state with fn(state) in place
+        template <typename Function>
+        void transformVertexStates(Function fn, size_t threads = 1) {
+            materializeVertexStates();
+            if ( resolveThreads(threads) <= 1 ) {
+                for ( std::pair<const vertex_t, V> & pair : vertex_state ) { pair.second = fn(pair.second); }
+                return;
+            }
+
+            std::vector<V*> states;
+            states.reserve(vertex_state.size());
+            for ( std::pair<const vertex_t, V> & pair : vertex_state ) { states.push_back(&pair.second); }
+            parallelFor(0, states.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { *states[i] = fn(*states[i]); }
+            });
         }
 
-        V getVertexState(vertex_t vertex) { Graph::validate(vertex); return vertex_state[vertex]; }
-        std::map<vertex_t, V> getVertexStates() { return vertex_state; }
+        template <typename Function>
+        void transformEdgeStates(Function fn, size_t threads = 1) {
+            materializeEdgeStates();
+            if ( resolveThreads(threads) <= 1 ) {
+                for ( std::pair<const edge_t, E> & pair : edge_state ) { pair.second = fn(pair.second); }
+                return;
+            }
 
-        E getEdgeState(edge_t edge) { validate(edge); return edge_state[edge]; }
-        std::map<edge_t, E> getEdgeWeights() { return edge_state; }
+            std::vector<E*> states;
+            states.reserve(edge_state.size());
+            for ( std::pair<const edge_t, E> & pair : edge_state ) { states.push_back(&pair.second); }
+            parallelFor(0, states.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { *states[i] = fn(*states[i]); }
+            });
+        }
 
-        void setVertexAutoState(V(*func)(vertex_t)) { vertex_auto_state = func; }
-        void setEdgeAutoState(E(*func)(edge_t)) { edge_auto_state = func; }
+        // Any callable works, including capturing lambdas and stateful functors.
+        // Lazy generation defers the call until the state is first read and
+        // memoizes it. States still pending under the previous generator are
+        // generated before it is replaced.
+        void setVertexAutoState(vertex_auto_state_t func, bool lazy = false) {
+            materializeVertexStates();
+            vertex_auto_state = std::move(func);
+            lazy_vertex_states = lazy && vertex_auto_state;
+        }
+
+        void setEdgeAutoState(edge_auto_state_t func, bool lazy = false) {
+            materializeEdgeStates();
+            edge_auto_state = std::move(func);
+            lazy_edge_states = lazy && edge_auto_state;
+        }
 
     };
 
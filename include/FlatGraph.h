@@ -0,0 +1,119 @@
+#ifndef GRAPPH_FLATGRAPH_H
+#define GRAPPH_FLATGRAPH_H
+
+#include "Graph.h"
+#include "Range.h"
+
+#include <iterator>
+#include <set>
+#include <vector>
+
+namespace grapph {
+
+    // Mutable graph storing one sorted neighbor vector per vertex, indexed
+    // directly by vertex id. Each edge costs two vertex_t entries instead of the
+    // three tree nodes Graph uses. Storage spans every id up to the largest, so
+    // ids must be dense: one at or past twice the vertex count plus
+    // MAX_ID_SLACK is rejected; Graph takes sparse ids.
+    class FlatGraph {
+
+    public:
+
+        static const size_t MAX_ID_SLACK = 1 << 16;
+
+        // Walks the ids of present vertices in increasing order
+        class VertexIterator {
+
+        private:
+
+            const std::vector<bool> * present;
+            vertex_t vertex;
+
+        public:
+
+            typedef std::forward_iterator_tag iterator_category;
+            typedef vertex_t value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const vertex_t* pointer;
+            typedef vertex_t reference;
+
+            VertexIterator(const std::vector<bool> * present, vertex_t vertex)
+            : present(present), vertex(vertex) {
+                while ( this->vertex < present->size() && !(*present)[this->vertex] ) { this->vertex++; }
+            }
+
+            vertex_t operator*() const { return vertex; }
+
+            VertexIterator& operator++() {
+                do { vertex++; } while ( vertex < present->size() && !(*present)[vertex] );
+                return *this;
+            }
+
+            VertexIterator operator++(int) { VertexIterator copy = *this; ++*this; return copy; }
+
+            bool operator==(const VertexIterator & other) const { return vertex == other.vertex; }
+            bool operator!=(const VertexIterator & other) const { return vertex != other.vertex; }
+
+        };
+
+        typedef Range<std::vector<vertex_t>::const_iterator> neighbor_view_t;
+        typedef Range<VertexIterator> vertex_view_t;
+
+    private:
+
+        std::vector<std::vector<vertex_t>> vertex_neighbors;
+        std::vector<bool> present;
+
+        size_t num_vertices = 0;
+        size_t num_edges = 0;
+
+        size_t next_vertex = 0;
+
+        void validate(vertex_t) const;
+        // Throw unless ids up to largest are dense enough for count vertices
+        static void checkDensity(vertex_t largest, size_t count);
+        bool adjacentUnchecked(edge_t) const;
+
+    public:
+
+        FlatGraph() = default;
+        FlatGraph(std::set<vertex_t>, std::set<edge_t>);
+        explicit FlatGraph(Graph&);
+
+        vertex_t addVertex();
+        vertex_t addVertex(vertex_t);
+        void removeVertex(vertex_t);
+
+        edge_t addEdge(vertex_t, vertex_t);
+        edge_t addEdge(edge_t);
+        void removeEdge(edge_t);
+
+        bool adjacent(vertex_t, vertex_t) const;
+        bool incident(vertex_t, edge_t) const;
+
+        std::set<vertex_t> getNeighbors(vertex_t) const;
+        size_t getDegree(vertex_t) const;
+
+        std::set<vertex_t> getVertices() const;
+        std::set<edge_t> getEdges() const;
+
+        // Read-only views of internal storage; no copies, invalidated by mutation
+        neighbor_view_t viewNeighbors(vertex_t) const;
+        vertex_view_t viewVertices() const;
+
+        size_t getNumVertices() const { return num_vertices; }
+        size_t getNumEdges() const { return num_edges; }
+
+        // Reserve room for vertex ids below the given bound
+        void reserve(size_t);
+
+        // Heap bytes held by the rows and the presence bits
+        size_t getBytesUsed() const;
+
+        Graph toGraph() const;
+
+    };
+
+}
+
+#endif //GRAPPH_FLATGRAPH_H
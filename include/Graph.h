@@ -2,23 +2,112 @@
 #define GRAPPH_H
 
 #include <cstddef>
+#include <cstdint>
 
+#include <memory_resource>
 #include <set>
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace grapph {
 
     typedef size_t vertex_t;
     typedef std::pair<vertex_t, vertex_t> edge_t;
 
+    // Containers behind Graph and its views; they allocate from the graph's
+    // memory resource, so a GraphArena can back a whole graph
+    typedef std::pmr::set<vertex_t>  vset_t;
+    typedef std::pmr::set<edge_t>    eset_t;
+
+    // Outcome of the non-throwing try* calls; only the throwing API turns
+    // these into exceptions
+    enum class Status {
+        SUCCESS,
+        VERTEX_EXISTS,
+        VERTEX_NOT_FOUND,
+        EDGE_EXISTS,
+        EDGE_NOT_FOUND,
+        NO_AUTO_STATE,
+        VERTEX_NOT_MAPPED,
+        VERTEX_OUT_OF_RANGE,
+        EDGE_OUT_OF_RANGE
+    };
+
+    // Union-find over vertex ids, kept by a Graph that tracks connectivity.
+    // Edges only ever merge sets; when a removal splits a component, the
+    // split-off vertices move to fresh nodes and the nodes they leave behind
+    // are reclaimed once they outnumber the live ones. Like the graph's own
+    // containers, it allocates from the graph's memory resource.
+    class ConnectivityIndex {
+
+    private:
+
+        std::pmr::unordered_map<vertex_t, size_t> nodes;
+
+        // Parents are rewritten by path halving during const queries
+        mutable std::pmr::vector<size_t> parents;
+        std::pmr::vector<size_t> sizes;
+
+        size_t num_components = 0;
+
+        size_t find(size_t) const;
+        size_t node(vertex_t) const;
+        void compact();
+
+    public:
+
+        ConnectivityIndex() = default;
+        explicit ConnectivityIndex(std::pmr::memory_resource*);
+        ConnectivityIndex(const ConnectivityIndex&, std::pmr::memory_resource*);
+
+        void clear();
+
+        void addVertex(vertex_t);
+        // The vertex must already have no edges
+        void removeVertex(vertex_t);
+        // Returns whether two components merged
+        bool unite(vertex_t, vertex_t);
+        // Give these vertices, the whole of a piece cut off from the rest of
+        // their component, a component of their own
+        void split(const std::vector<vertex_t>&);
+
+        bool connected(vertex_t, vertex_t) const;
+        size_t getNumComponents() const { return num_components; }
+
+    };
+
     class Graph {
 
+        friend class GraphBuilder;
+
     private:
 
-        std::set<vertex_t> vertices;
-        std::set<edge_t> edges;
+        vset_t vertices;
+        eset_t edges;
+
+        std::pmr::map<vertex_t, vset_t> vertex_neighbors;
+
+        // Sorted, ordered edges with both endpoints in the sorted id list,
+        // found by walking only those vertices' rows
+        std::vector<edge_t> inducedEdges(const std::vector<vertex_t>&, size_t threads) const;
+
+        // Per-element terms of the fingerprint
+        static uint64_t hashVertex(vertex_t);
+        static uint64_t hashEdge(edge_t);
+
+        bool track_connectivity = false;
+        ConnectivityIndex connectivity;
 
-        std::map<vertex_t, std::set<vertex_t>> vertex_neighbors;
+        // Search outward from both vertices at once, always growing the side
+        // that has found fewer vertices; if one side runs out first the two
+        // are disconnected and that side's vertices are left in piece
+        bool reachable(vertex_t, vertex_t, std::vector<vertex_t> * piece = nullptr) const;
+
+        // Split off every piece the given vertices, which shared a component
+        // before a removal, now fall into, searching from all of them at once
+        void separate(const std::vector<vertex_t>&);
 
     protected:
 
@@ -27,12 +116,34 @@ namespace grapph {
 
         size_t next_vertex = 0;
 
-        void validate(vertex_t);
+        // Sum of hashVertex over vertices and hashEdge over edges, so it is
+        // independent of insertion order and updated in O(1) per change
+        uint64_t fingerprint = 0;
+
+        void validate(vertex_t) const;
+
+        // Fill an empty graph in one pass from sorted, unique vertices and
+        // sorted, unique, ordered edges whose endpoints are all present
+        void assign(const std::vector<vertex_t>&, const std::vector<edge_t>&);
+
+        // Report every problem in sorted input instead of stopping at the first
+        static std::vector<std::string> checkVertexList(const std::vector<vertex_t>&, size_t threads = 1);
+        static std::vector<std::string> checkEdgeList(const std::vector<vertex_t>&,
+                                                      const std::vector<edge_t>&, size_t threads = 1);
+        static void throwIfInvalid(const std::vector<std::string>&);
 
     public:
 
         Graph() = default;
-        Graph(std::set<vertex_t>, std::set<edge_t>);
+        // Every vertex, edge and neighbor entry is allocated from the resource,
+        // which must outlive the graph
+        explicit Graph(std::pmr::memory_resource*);
+        Graph(std::set<vertex_t>, std::set<edge_t>,
+              std::pmr::memory_resource * resource = std::pmr::get_default_resource());
+        // Plain copies take the default resource
+        Graph(const Graph&, std::pmr::memory_resource*);
+
+        std::pmr::memory_resource* getResource() const { return vertices.get_allocator().resource(); }
 
         virtual vertex_t addVertex();
         virtual vertex_t addVertex(vertex_t);
@@ -42,16 +153,36 @@ namespace grapph {
         virtual edge_t addEdge(edge_t);
         virtual void removeEdge(edge_t);
 
+        bool hasVertex(vertex_t) const;
+        bool hasEdge(vertex_t, vertex_t) const;
+        bool hasEdge(edge_t) const;
+
+        virtual Status tryAddVertex(vertex_t);
+        virtual Status tryRemoveVertex(vertex_t);
+
+        virtual Status tryAddEdge(vertex_t, vertex_t);
+        virtual Status tryAddEdge(edge_t);
+        virtual Status tryRemoveEdge(edge_t);
+
         bool adjacent(vertex_t, vertex_t);
         bool incident(vertex_t, edge_t);
 
         std::set<vertex_t> getNeighbors(vertex_t);
         size_t getDegree(vertex_t);
 
-        std::set<vertex_t> getVertices() { return vertices; }
-        std::set<edge_t> getEdges() { return edges; }
+        std::set<vertex_t> getVertices() { return std::set<vertex_t>(vertices.begin(), vertices.end()); }
+        std::set<edge_t> getEdges() { return std::set<edge_t>(edges.begin(), edges.end()); }
 
-        Graph induce(std::set<vertex_t>&);
+        // Read-only views of internal storage; no copies, invalidated by mutation
+        const vset_t& viewNeighbors(vertex_t) const;
+        const vset_t& viewVertices() const { return vertices; }
+        const eset_t& viewEdges() const { return edges; }
+
+        // Relabeling numbers the kept vertices 0..k-1 in id order; the
+        // subgraph allocates from the given resource, by default this graph's,
+        // and tracks connectivity when this graph does
+        Graph induce(std::set<vertex_t>&, size_t threads = 1, bool relabel = false,
+                     std::pmr::memory_resource * resource = nullptr);
 
         bool contains(Graph&);
         bool spannedBy(Graph&);
@@ -59,6 +190,21 @@ namespace grapph {
 
         bool equals(Graph&);
 
+        // Graphs with different fingerprints are certainly not equal
+        uint64_t getFingerprint() const { return fingerprint; }
+
+        // Keep a union-find index up to date through every change, so that
+        // connected and getNumComponents answer in near constant time. Adding
+        // edges and vertices costs a union; removing an edge searches from
+        // both ends, which stops after the smaller side when it splits off,
+        // and removing a vertex searches once from all its former neighbors.
+        void trackConnectivity(bool enabled = true);
+        bool tracksConnectivity() const { return track_connectivity; }
+
+        // Without the index these search the graph
+        bool connected(vertex_t, vertex_t) const;
+        size_t getNumComponents() const;
+
         static std::set<edge_t> getEdgeSpace(std::set<vertex_t>&);
 
         template <typename T>
@@ -0,0 +1,60 @@
+#ifndef GRAPPH_GRAPHARENA_H
+#define GRAPPH_GRAPHARENA_H
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace grapph {
+
+    // Monotonic memory resource for graphs that are built, read and thrown
+    // away together. Allocation bumps a pointer through blocks taken from the
+    // upstream resource, and deallocation does nothing; release hands every
+    // block back at once. Pass it to the Graph, FeatureGraph and Homomorphism
+    // constructors, or to induce, so their nodes come from the arena. Not
+    // thread-safe; use one arena per thread.
+    class GraphArena : public std::pmr::memory_resource {
+
+    private:
+
+        std::pmr::monotonic_buffer_resource buffer;
+
+        size_t bytes_allocated = 0;
+
+    protected:
+
+        void * do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void *, size_t, size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+
+    public:
+
+        explicit GraphArena(size_t initial_size = 64 << 10,
+                            std::pmr::memory_resource * upstream = std::pmr::new_delete_resource());
+
+        GraphArena(const GraphArena&) = delete;
+        GraphArena& operator=(const GraphArena&) = delete;
+
+        // Construct an object inside the arena. It is never destroyed: its
+        // memory goes with the arena's, so tearing down a graph made this way
+        // costs nothing per node. Only give it objects whose memory all comes
+        // from this arena (e.g. no auto state callables that allocate).
+        template <typename T, typename... Args>
+        T& create(Args&&... args) {
+            void * address = do_allocate(sizeof(T), alignof(T));
+            return *new (address) T(std::forward<Args>(args)...);
+        }
+
+        // Give every block back upstream; everything allocated from the arena,
+        // including objects from create, is gone
+        void release();
+
+        // Bytes handed out since construction or the last release
+        size_t getBytesAllocated() const { return bytes_allocated; }
+
+    };
+
+}
+
+#endif //GRAPPH_GRAPHARENA_H
@@ -0,0 +1,59 @@
+#ifndef GRAPPH_GRAPHBUILDER_H
+#define GRAPPH_GRAPHBUILDER_H
+
+#include "Graph.h"
+#include "CompactGraph.h"
+
+#include <string>
+#include <vector>
+
+namespace grapph {
+
+    // Collects an unsorted vertex and edge list, then sorts, deduplicates and
+    // checks it across threads before filling a graph's adjacency in one pass.
+    // By default edge endpoints are added as vertices and repeated edges are
+    // merged; in strict mode both are reported as problems, like Graph's
+    // set-based constructor would.
+    class GraphBuilder {
+
+    private:
+
+        std::vector<vertex_t> vertices;
+        std::vector<edge_t> edges;
+
+        size_t threads;
+        bool strict = false;
+
+        bool prepared = false;
+        std::vector<std::string> problems;
+
+        void prepare();
+
+    public:
+
+        explicit GraphBuilder(size_t threads = 1) : threads(threads) {}
+
+        GraphBuilder& setStrict(bool);
+        GraphBuilder& reserve(size_t, size_t);
+
+        GraphBuilder& addVertex(vertex_t);
+        GraphBuilder& addVertices(const std::vector<vertex_t>&);
+        // Takes the list over without copying when nothing was added yet
+        GraphBuilder& addVertices(std::vector<vertex_t>&&);
+
+        GraphBuilder& addEdge(vertex_t, vertex_t);
+        GraphBuilder& addEdge(edge_t);
+        GraphBuilder& addEdges(const std::vector<edge_t>&);
+        GraphBuilder& addEdges(std::vector<edge_t>&&);
+
+        // Every problem found in the input; empty when it builds cleanly
+        std::vector<std::string> validate();
+
+        Graph build();
+        CompactGraph buildCompact();
+
+    };
+
+}
+
+#endif //GRAPPH_GRAPHBUILDER_H
@@ -0,0 +1,85 @@
+#ifndef GRAPPH_GRAPHREADER_H
+#define GRAPPH_GRAPHREADER_H
+
+#include "CompactGraph.h"
+#include "FeatureGraph.h"
+#include "Graph.h"
+#include "Parallel.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace grapph {
+
+    enum class GraphFormat {
+        // One "u v [weight]" pair per line, as in SNAP; lines starting with
+        // # or % are comments. Vertices are the endpoints.
+        EDGE_LIST,
+        // Coordinate Matrix Market of a square matrix; entry (i, j) is edge
+        // (i - 1, j - 1) and every row is a vertex. Pattern matrices have
+        // no weights.
+        MATRIX_MARKET,
+        // METIS/Chaco adjacency: a header line, then one line of 1-based
+        // neighbors (followed by weights if the header says so) per vertex
+        METIS
+    };
+
+    // Reads graphs from text files. The file is mapped and cut into one chunk
+    // per thread at line boundaries; each chunk is parsed by hand into its
+    // own edge list, and the lists feed GraphBuilder's bulk construction (or
+    // FeatureGraph's bulk constructor for weighted reads). Edges are
+    // undirected, so (u, v) and (v, u) are one edge; of repeated edges the
+    // first weight read wins. Malformed input throws with the file and line.
+    class GraphReader {
+
+    private:
+
+        size_t threads;
+
+        // Vertices the format declares, edges, and one weight per edge
+        // when weights were asked for
+        std::vector<vertex_t> vertices;
+        std::vector<edge_t> edges;
+        std::vector<double> weights;
+
+        void parse(const std::string & path, GraphFormat format, bool weighted);
+
+        // Order, sort and merge the weighted edges, and declare every
+        // endpoint as a vertex
+        void prepareWeighted();
+
+    public:
+
+        explicit GraphReader(size_t threads = 1) : threads(threads) {}
+
+        Graph read(const std::string & path, GraphFormat format);
+        CompactGraph readCompact(const std::string & path, GraphFormat format);
+
+        // Weights become edge states; every vertex gets the given state.
+        // Throws if the file has no weight column.
+        template <typename V, typename E>
+        FeatureGraph<V, E> readFeatures(const std::string & path, GraphFormat format, const V & vertex_state = V()) {
+            parse(path, format, true);
+            prepareWeighted();
+
+            std::vector<std::pair<vertex_t, V>> vertex_list(vertices.size());
+            std::vector<std::pair<edge_t, E>> edge_list(edges.size());
+            parallelFor(0, vertices.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { vertex_list[i] = { vertices[i], vertex_state }; }
+            });
+            parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) { edge_list[i] = { edges[i], static_cast<E>(weights[i]) }; }
+            });
+            vertices.clear();
+            edges.clear();
+            weights.clear();
+
+            return FeatureGraph<V, E>(std::move(vertex_list), std::move(edge_list), threads);
+        }
+
+    };
+
+}
+
+#endif //GRAPPH_GRAPHREADER_H
@@ -4,11 +4,12 @@
 #include "Graph.h"
 
 #include <map>
+#include <memory_resource>
 
 namespace grapph {
 
-    typedef std::map<vertex_t, vertex_t>    vfunc_t;
-    typedef std::map<edge_t, edge_t>        efunc_t;
+    typedef std::pmr::map<vertex_t, vertex_t>   vfunc_t;
+    typedef std::pmr::map<edge_t, edge_t>       efunc_t;
 
     class Homomorphism {
 
@@ -24,8 +25,15 @@ namespace grapph {
 
     public:
 
+        // The edge map allocates from the vertex map's memory resource
         Homomorphism(Graph&, Graph&, vfunc_t);
 
+        // Check a vertex map without constructing anything or throwing
+        static Status check(Graph&, Graph&, const vfunc_t&);
+
+        Status tryMapVertex(vertex_t, vertex_t&) const;
+        Status tryMapEdge(edge_t, edge_t&) const;
+
         Graph& getFromGraph() { return from; }
         Graph& getToGraph() { return to; }
 
@@ -38,6 +46,11 @@ namespace grapph {
 
         static Homomorphism compose(Homomorphism, Homomorphism);
 
+        // Induce graph on a vertex subset relabeled 0..k-1 into the given graph,
+        // and return the embedding of that graph back into the original; the
+        // subgraph and both maps allocate from the given graph's resource
+        static Homomorphism induce(Graph&, std::set<vertex_t>&, Graph&, size_t threads = 1);
+
     };
 
 }
@@ -0,0 +1,59 @@
+#ifndef GRAPPH_HOMOMORPHISMVALIDATOR_H
+#define GRAPPH_HOMOMORPHISMVALIDATOR_H
+
+#include "Graph.h"
+#include "Homomorphism.h"
+#include "VertexIndex.h"
+
+#include <vector>
+
+namespace grapph {
+
+    // Checks many candidate vertex maps between one fixed pair of graphs. The
+    // from-graph is flattened once so each check is a lockstep domain scan and
+    // one adjacency probe per edge, stopping at the first violation. Both
+    // graphs must outlive the validator and must not change while it is used.
+    class HomomorphismValidator {
+
+    private:
+
+        Graph & from;
+        Graph & to;
+
+        size_t threads;
+
+        VertexIndex from_index;
+
+        // Edges of the from-graph as positions into from_index
+        std::vector<std::pair<size_t, size_t>> edge_positions;
+
+        // Scratch image of a map, reused across checks
+        std::vector<vertex_t> image;
+
+        Status checkEdges(const std::vector<vertex_t>&) const;
+
+    public:
+
+        // Edge checks are split across threads only for large from-graphs
+        static const size_t PARALLEL_EDGE_THRESHOLD = 1 << 14;
+
+        HomomorphismValidator(Graph&, Graph&, size_t threads = 1);
+
+        Status check(const vfunc_t&);
+
+        // Dense map: the i-th entry is the image of the i-th smallest from-vertex
+        Status check(const std::vector<vertex_t>&) const;
+
+        bool isValid(const vfunc_t& vertex_map) { return check(vertex_map) == Status::SUCCESS; }
+        bool isValid(const std::vector<vertex_t>& image) const { return check(image) == Status::SUCCESS; }
+
+        Graph& getFromGraph() { return from; }
+        Graph& getToGraph() { return to; }
+
+        const VertexIndex& getFromIndex() const { return from_index; }
+
+    };
+
+}
+
+#endif //GRAPPH_HOMOMORPHISMVALIDATOR_H
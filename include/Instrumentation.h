@@ -0,0 +1,154 @@
+#ifndef GRAPPH_INSTRUMENTATION_H
+#define GRAPPH_INSTRUMENTATION_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+
+namespace grapph {
+
+    // Operations the library times when built with GRAPPH_INSTRUMENT
+    enum class Operation {
+        ADD_VERTEX,
+        REMOVE_VERTEX,
+        ADD_EDGE,
+        REMOVE_EDGE,
+        HAS_VERTEX,
+        HAS_EDGE,
+        ADJACENT,
+        GET_NEIGHBORS,
+        INDUCE,
+        EQUALS,
+        HOMOMORPHISM_VALIDATE
+    };
+
+    const size_t NUM_OPERATIONS = 11;
+
+    const char* operationName(Operation);
+
+    // Calls of one operation. Latencies go into power-of-two buckets: bucket
+    // i holds calls that took [2^i, 2^(i+1)) ns, and the last bucket takes
+    // everything longer.
+    struct OperationStats {
+
+        static const size_t NUM_BUCKETS = 40;
+
+        uint64_t calls = 0;
+        // Calls that left by throwing, mostly from validation
+        uint64_t exceptions = 0;
+        uint64_t total_nanos = 0;
+        uint64_t max_nanos = 0;
+        std::array<uint64_t, NUM_BUCKETS> histogram{};
+
+        double meanNanos() const { return calls == 0 ? 0.0 : double(total_nanos) / calls; }
+
+        // Upper bound of the bucket holding the q-th quantile, q in [0, 1]
+        uint64_t percentileNanos(double q) const;
+
+    };
+
+    struct InstrumentationSnapshot {
+
+        std::array<OperationStats, NUM_OPERATIONS> operations;
+
+        // Traffic through the default memory resource while countAllocations
+        // is on; every Graph container allocates there unless given a resource
+        uint64_t allocations = 0;
+        uint64_t bytes_allocated = 0;
+        uint64_t bytes_deallocated = 0;
+
+        // Missing vertices and edges, counted where validation throws, so
+        // untimed calls such as getDegree, viewNeighbors, incident and the
+        // FeatureGraph getters are included
+        uint64_t validation_failures = 0;
+
+        const OperationStats& operator[](Operation operation) const {
+            return operations[static_cast<size_t>(operation)];
+        }
+
+    };
+
+    // Process-wide counters behind the GRAPPH_INSTRUMENT build flag. Without
+    // the flag the library has no hooks at all, and these calls do nothing
+    // and report zeros. Counters are atomic, so graphs on several threads
+    // can record at once. Counts include calls the library makes itself,
+    // e.g. Homomorphism's checks through hasEdge.
+    class Instrumentation {
+
+    public:
+
+#ifdef GRAPPH_INSTRUMENT
+        static constexpr bool enabled = true;
+#else
+        static constexpr bool enabled = false;
+#endif
+
+        static InstrumentationSnapshot snapshot();
+
+        // Zero every counter and histogram and drop recorded trace events
+        static void reset();
+
+        // Put a counting wrapper around the default memory resource, or take
+        // it off again. Containers made while it is on keep using it, so turn
+        // it off only once they are gone.
+        static void countAllocations(bool enable = true);
+
+        // Keep a trace event for every call that takes at least this long;
+        // UINT64_MAX, the default, keeps none. At most MAX_TRACE_EVENTS are
+        // kept between resets.
+        static void traceSlowerThan(uint64_t nanos);
+        static size_t getNumTraceEvents();
+
+        static const size_t MAX_TRACE_EVENTS = 1 << 20;
+
+        // Write the kept events as Chrome trace-event JSON, for
+        // chrome://tracing or Perfetto. Throws if the file cannot be written.
+        static void writeTrace(const std::string & path);
+
+        static void record(Operation, std::chrono::steady_clock::time_point start, uint64_t nanos, bool threw);
+        static void recordValidationFailure();
+
+    };
+
+    // Times a call from construction to destruction; a destructor reached
+    // while an exception unwinds the call counts as a throw
+    class OperationTimer {
+
+    private:
+
+        Operation operation;
+        int uncaught;
+        std::chrono::steady_clock::time_point start;
+
+    public:
+
+        explicit OperationTimer(Operation operation)
+        : operation(operation), uncaught(std::uncaught_exceptions()), start(std::chrono::steady_clock::now()) {}
+
+        OperationTimer(const OperationTimer&) = delete;
+        OperationTimer& operator=(const OperationTimer&) = delete;
+
+        ~OperationTimer() {
+            uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+            Instrumentation::record(operation, start, nanos, std::uncaught_exceptions() > uncaught);
+        }
+
+    };
+
+}
+
+// Time the rest of the enclosing scope as one call of the operation, and
+// count a validation failure just before it throws
+#ifdef GRAPPH_INSTRUMENT
+#define GRAPPH_INSTRUMENT_SCOPE(operation) ::grapph::OperationTimer grapph_operation_timer(operation)
+#define GRAPPH_INSTRUMENT_VALIDATION_FAILURE() ::grapph::Instrumentation::recordValidationFailure()
+#else
+#define GRAPPH_INSTRUMENT_SCOPE(operation) ((void) 0)
+#define GRAPPH_INSTRUMENT_VALIDATION_FAILURE() ((void) 0)
+#endif
+
+#endif //GRAPPH_INSTRUMENTATION_H
@@ -0,0 +1,127 @@
+#ifndef GRAPPH_PARALLEL_H
+#define GRAPPH_PARALLEL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace grapph {
+
+    // Thread counts across the library: 0 means one per hardware thread, 1 runs inline
+    inline size_t resolveThreads(size_t threads) {
+        if ( threads != 0 ) { return threads; }
+
+        size_t hardware = std::thread::hardware_concurrency();
+        return hardware == 0 ? 1 : hardware;
+    }
+
+    // Split [begin, end) into one contiguous chunk per worker and call
+    // fn(chunk_begin, chunk_end, worker) on each; the first exception thrown
+    // by any worker is rethrown once all of them have joined
+    template <typename Function>
+    void parallelFor(size_t begin, size_t end, size_t threads, Function fn) {
+        size_t n = end > begin ? end - begin : 0;
+        size_t workers = std::min(resolveThreads(threads), std::max<size_t>(n, 1));
+        if ( workers <= 1 ) {
+            fn(begin, end, 0);
+            return;
+        }
+
+        std::vector<std::thread> pool;
+        std::vector<std::exception_ptr> errors(workers);
+        size_t chunk = (n + workers - 1) / workers;
+        for ( size_t worker = 0; worker < workers; worker++ ) {
+            size_t lo = begin + std::min(n, worker * chunk);
+            size_t hi = begin + std::min(n, (worker + 1) * chunk);
+            pool.emplace_back([&fn, &errors, lo, hi, worker]() {
+                try {
+                    fn(lo, hi, worker);
+                } catch ( ... ) {
+                    errors[worker] = std::current_exception();
+                }
+            });
+        }
+        for ( std::thread & thread : pool ) { thread.join(); }
+
+        for ( std::exception_ptr & error : errors ) {
+            if ( error ) { std::rethrow_exception(error); }
+        }
+    }
+
+    // Sort chunks concurrently, then merge neighbouring runs pairwise
+    template <typename Iterator, typename Compare>
+    void parallelSort(Iterator first, Iterator last, Compare comp, size_t threads) {
+        size_t n = last - first;
+        size_t workers = resolveThreads(threads);
+        if ( workers <= 1 || n < 4096 ) {
+            std::sort(first, last, comp);
+            return;
+        }
+
+        // Sort one run per worker
+        size_t chunk = (n + workers - 1) / workers;
+        parallelFor(0, workers, workers, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t run = lo; run < hi; run++ ) {
+                std::sort(first + std::min(n, run * chunk), first + std::min(n, (run + 1) * chunk), comp);
+            }
+        });
+
+        // Merge runs of doubling width
+        for ( size_t width = chunk; width < n; width *= 2 ) {
+            size_t merges = (n + 2 * width - 1) / (2 * width);
+            parallelFor(0, merges, workers, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t merge = lo; merge < hi; merge++ ) {
+                    size_t left = merge * 2 * width;
+                    size_t middle = std::min(n, left + width);
+                    size_t right = std::min(n, left + 2 * width);
+                    std::inplace_merge(first + left, first + middle, first + right, comp);
+                }
+            });
+        }
+    }
+
+    template <typename Iterator>
+    void parallelSort(Iterator first, Iterator last, size_t threads) {
+        parallelSort(first, last, std::less<typename std::iterator_traits<Iterator>::value_type>(), threads);
+    }
+
+    // Drop adjacent duplicates from a sorted vector; workers count survivors
+    // in their chunk, then scatter them to prefix-summed offsets
+    template <typename T>
+    void parallelUnique(std::vector<T> & values, size_t threads) {
+        size_t n = values.size();
+        size_t workers = std::min(resolveThreads(threads), std::max<size_t>(n, 1));
+        if ( workers <= 1 || n < 4096 ) {
+            values.erase(std::unique(values.begin(), values.end()), values.end());
+            return;
+        }
+
+        // Count the first element of each run of equal values
+        std::vector<size_t> offsets(workers + 1, 0);
+        parallelFor(0, n, workers, [&](size_t lo, size_t hi, size_t worker) {
+            size_t kept = 0;
+            for ( size_t i = lo; i < hi; i++ ) {
+                if ( i == 0 || !(values[i] == values[i - 1]) ) { kept++; }
+            }
+            offsets[worker + 1] = kept;
+        });
+        for ( size_t worker = 0; worker < workers; worker++ ) { offsets[worker + 1] += offsets[worker]; }
+
+        // Scatter survivors; the same split is reproduced by parallelFor
+        std::vector<T> unique(offsets[workers]);
+        parallelFor(0, n, workers, [&](size_t lo, size_t hi, size_t worker) {
+            size_t at = offsets[worker];
+            for ( size_t i = lo; i < hi; i++ ) {
+                if ( i == 0 || !(values[i] == values[i - 1]) ) { unique[at++] = values[i]; }
+            }
+        });
+        values.swap(unique);
+    }
+
+}
+
+#endif //GRAPPH_PARALLEL_H
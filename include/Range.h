@@ -0,0 +1,34 @@
+#ifndef GRAPPH_RANGE_H
+#define GRAPPH_RANGE_H
+
+#include <cstddef>
+
+namespace grapph {
+
+    // Non-owning [begin, end) view over storage owned by a graph. Valid until
+    // the graph is next modified.
+    template <typename Iterator>
+    class Range {
+
+    private:
+
+        Iterator first;
+        Iterator last;
+        size_t count;
+
+    public:
+
+        Range(Iterator first, Iterator last, size_t count)
+        : first(first), last(last), count(count) {}
+
+        Iterator begin() const { return first; }
+        Iterator end() const { return last; }
+
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+    };
+
+}
+
+#endif //GRAPPH_RANGE_H
@@ -1,61 +1,126 @@
 #ifndef GRAPPH_SETFUNCTIONS_H
 #define GRAPPH_SETFUNCTIONS_H
 
+#include "Graph.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <set>
+#include <vector>
 
 namespace grapph {
 
-    template <typename T>
-    static std::set<T> setUnion(std::set<T>& first, std::set<T>& second) {
-        std::set<T> set_union;
+    // Whether looking each of `small` elements up in a set of `large` beats
+    // merging both; a lookup costs about log2(large) steps
+    static inline bool probeCheaper(size_t small, size_t large) {
+        size_t depth = 1;
+        while ( (size_t(1) << depth) < large ) { depth++; }
+        return small * depth < small + large;
+    }
 
-        for ( T t : first ) {
-            set_union.insert(t);
-        }
+    // The set templates walk both ordered inputs once and append results at
+    // the end of the output, so each runs in O(n + m) instead of O(n log m).
+    // When one input is much smaller, its elements are looked up instead.
+    // Inputs may use different allocators; results take the first one's.
 
-        for ( T t : second ) {
-            set_union.insert(t);
-        }
+    template <typename T, typename A, typename B>
+    static std::set<T, std::less<T>, A> setUnion(const std::set<T, std::less<T>, A>& first,
+                                                 const std::set<T, std::less<T>, B>& second) {
+        std::set<T, std::less<T>, A> set_union(first.get_allocator());
+
+        std::set_union(first.begin(), first.end(), second.begin(), second.end(),
+                       std::inserter(set_union, set_union.end()), first.value_comp());
 
         return set_union;
     }
 
-    template <typename T>
-    static std::set<T> setIntersection(std::set<T>& first, std::set<T>& second) {
-        std::set<T> set_intersection;
-
-        for ( T t : first ) {
-            if ( second.count(t) != 0 )  set_intersection.insert(t);
+    template <typename T, typename A, typename B>
+    static std::set<T, std::less<T>, A> setIntersection(const std::set<T, std::less<T>, A>& first,
+                                                        const std::set<T, std::less<T>, B>& second) {
+        std::set<T, std::less<T>, A> set_intersection(first.get_allocator());
+
+        // Probe from the smaller side; both iterate in order, so hints hold
+        if ( first.size() <= second.size() && probeCheaper(first.size(), second.size()) ) {
+            for ( const T & t : first ) {
+                if ( second.count(t) != 0 )  set_intersection.insert(set_intersection.end(), t);
+            }
+        } else if ( second.size() < first.size() && probeCheaper(second.size(), first.size()) ) {
+            for ( const T & t : second ) {
+                if ( first.count(t) != 0 )  set_intersection.insert(set_intersection.end(), t);
+            }
+        } else {
+            std::set_intersection(first.begin(), first.end(), second.begin(), second.end(),
+                                  std::inserter(set_intersection, set_intersection.end()), first.value_comp());
         }
 
         return set_intersection;
     }
 
-    template <typename T>
-    static std::set<T> setDifference(std::set<T>& minuend, std::set<T>& subtrahend) {
-        std::set<T> set_difference;
-
-        for ( T t : minuend ) {
-            if ( subtrahend.count(t) == 0 )  set_difference.insert(t);
+    template <typename T, typename A, typename B>
+    static std::set<T, std::less<T>, A> setDifference(const std::set<T, std::less<T>, A>& minuend,
+                                                      const std::set<T, std::less<T>, B>& subtrahend) {
+        std::set<T, std::less<T>, A> set_difference(minuend.get_allocator());
+
+        if ( probeCheaper(minuend.size(), subtrahend.size()) ) {
+            for ( const T & t : minuend ) {
+                if ( subtrahend.count(t) == 0 )  set_difference.insert(set_difference.end(), t);
+            }
+        } else {
+            std::set_difference(minuend.begin(), minuend.end(), subtrahend.begin(), subtrahend.end(),
+                                std::inserter(set_difference, set_difference.end()), minuend.value_comp());
         }
 
         return set_difference;
     }
 
-    template <typename T>
-    static bool setContains(std::set<T>& super, std::set<T>& sub) {
-        for ( T t : sub ) {
-            if ( super.count(t) == 0 )  return false;
+    template <typename T, typename A, typename B>
+    static bool setContains(const std::set<T, std::less<T>, A>& super,
+                            const std::set<T, std::less<T>, B>& sub) {
+        if ( sub.size() > super.size() )  return false;
+
+        if ( probeCheaper(sub.size(), super.size()) ) {
+            for ( const T & t : sub ) {
+                if ( super.count(t) == 0 )  return false;
+            }
+            return true;
         }
 
-        return true;
+        return std::includes(super.begin(), super.end(), sub.begin(), sub.end(), super.value_comp());
     }
 
-    template <typename T>
-    static bool setEquals(std::set<T>& a, std::set<T>& b) {
-        return setContains(a, b) && setContains(b, a);
+    template <typename T, typename A, typename B>
+    static bool setEquals(const std::set<T, std::less<T>, A>& a, const std::set<T, std::less<T>, B>& b) {
+        return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
     }
 
+    // Instruction sets the sorted array kernels can use; a level the CPU
+    // lacks falls back to the widest one it has
+    enum class SimdLevel {
+        AUTO,
+        SCALAR,
+        SSE41,
+        AVX2
+    };
+
+    // Widest level supported by the running CPU
+    SimdLevel detectSimdLevel();
+
+    // Kernels over sorted, duplicate-free vertex arrays such as CompactGraph
+    // rows. Results are written in ascending order to out, which needs room
+    // for min(na, nb) entries (intersection) or na + nb entries (union); the
+    // number written is returned.
+    size_t sortedIntersection(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                              vertex_t * out, SimdLevel level = SimdLevel::AUTO);
+    size_t sortedIntersectionCount(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                                   SimdLevel level = SimdLevel::AUTO);
+    size_t sortedUnion(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                       vertex_t * out, SimdLevel level = SimdLevel::AUTO);
+
+    std::vector<vertex_t> sortedIntersection(const std::vector<vertex_t>&, const std::vector<vertex_t>&);
+    std::vector<vertex_t> sortedUnion(const std::vector<vertex_t>&, const std::vector<vertex_t>&);
+
 }
 
 #endif //GRAPPH_SETFUNCTIONS_H
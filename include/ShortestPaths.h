@@ -0,0 +1,442 @@
+#ifndef GRAPPH_SHORTESTPATHS_H
+#define GRAPPH_SHORTESTPATHS_H
+
+#include "ColumnarFeatureGraph.h"
+#include "FeatureGraph.h"
+#include "Parallel.h"
+#include "VertexIndex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace grapph {
+
+    // Indexed 4-ary min-heap over dense positions with decrease-key. Four
+    // children share a cache line of keys, so the tree is half as deep as a
+    // binary heap and each sift touches fewer lines.
+    class QuaternaryHeap {
+
+    private:
+
+        std::vector<double> keys;
+        std::vector<size_t> items;
+        // Heap slot of each position, or npos when not queued
+        std::vector<size_t> slots;
+
+        void place(size_t slot, double key, size_t item) {
+            keys[slot] = key;
+            items[slot] = item;
+            slots[item] = slot;
+        }
+
+        void siftUp(size_t slot, double key, size_t item) {
+            while ( slot > 0 ) {
+                size_t parent = (slot - 1) / 4;
+                if ( keys[parent] <= key ) { break; }
+                place(slot, keys[parent], items[parent]);
+                slot = parent;
+            }
+            place(slot, key, item);
+        }
+
+        void siftDown(size_t slot, double key, size_t item) {
+            size_t size = keys.size();
+            while ( true ) {
+                size_t first = 4 * slot + 1;
+                if ( first >= size ) { break; }
+
+                size_t best = first;
+                size_t last = std::min(first + 4, size);
+                for ( size_t child = first + 1; child < last; child++ ) {
+                    if ( keys[child] < keys[best] ) { best = child; }
+                }
+                if ( key <= keys[best] ) { break; }
+
+                place(slot, keys[best], items[best]);
+                slot = best;
+            }
+            place(slot, key, item);
+        }
+
+    public:
+
+        static const size_t npos = static_cast<size_t>(-1);
+
+        explicit QuaternaryHeap(size_t positions) : slots(positions, size_t(npos)) {}
+
+        bool empty() const { return keys.empty(); }
+        double topKey() const { return keys.front(); }
+        size_t top() const { return items.front(); }
+
+        // Insert, or lower the key of a queued position
+        void push(size_t item, double key) {
+            if ( slots[item] == npos ) {
+                keys.push_back(key);
+                items.push_back(item);
+                siftUp(keys.size() - 1, key, item);
+            } else if ( key < keys[slots[item]] ) {
+                siftUp(slots[item], key, item);
+            }
+        }
+
+        size_t pop() {
+            size_t item = items.front();
+            slots[item] = npos;
+
+            double key = keys.back();
+            size_t last = items.back();
+            keys.pop_back();
+            items.pop_back();
+            if ( !keys.empty() ) { siftDown(0, key, last); }
+
+            return item;
+        }
+
+    };
+
+    // Shortest paths over the edge states of a FeatureGraph, read as
+    // non-negative distances through a projection from E (by default a
+    // plain conversion to double). The graph is frozen into position-indexed
+    // rows with one weight per slot on construction, so later changes to the
+    // FeatureGraph are not seen.
+    //
+    // dijkstra and deltaStepping fill distances and parents from one source;
+    // bidirectional answers a single source-target query on its own.
+    template <typename V, typename E>
+    class ShortestPaths {
+
+    public:
+
+        typedef std::function<double(const E&)> weight_t;
+
+    private:
+
+        VertexIndex index;
+
+        std::vector<size_t> offsets;
+        std::vector<size_t> targets;
+        std::vector<double> weights;
+
+        size_t threads = 0;
+        double delta = 0;
+
+        // Results of the last single-source run, per position
+        std::vector<double> distances;
+        std::vector<size_t> parents;
+
+        // Position of vertex among the results of the last run
+        size_t validateResult(vertex_t vertex) const {
+            size_t position = validate(vertex);
+            if ( distances.empty() ) {
+                throw std::logic_error("No shortest paths computed; run dijkstra or deltaStepping first");
+            }
+
+            return position;
+        }
+
+        size_t validate(vertex_t vertex) const {
+            size_t position = index.indexOf(vertex);
+            if ( position == VertexIndex::npos ) {
+                std::stringstream ss;
+                ss << "Vertex " << vertex << " not found in graph";
+                throw std::invalid_argument(ss.str());
+            }
+
+            return position;
+        }
+
+        void build(const ColumnarFeatureGraph<V, E> & graph, const weight_t & weight) {
+            const CompactGraph & structure = graph.getGraph();
+            const Buffer<E> & states = graph.viewEdgeStates();
+            index = structure.getIndex();
+
+            // Weigh every edge once, then copy weights into both endpoint rows
+            std::vector<double> edge_weights(states.size());
+            for ( size_t id = 0; id < states.size(); id++ ) {
+                edge_weights[id] = weight(states[id]);
+                if ( !(edge_weights[id] >= 0) ) {
+                    const edge_t & edge = graph.viewEdgeList()[id];
+                    std::stringstream ss;
+                    ss << "Edge (" << edge.first << ", " << edge.second << ") has negative weight " << edge_weights[id];
+                    throw std::invalid_argument(ss.str());
+                }
+            }
+
+            // Self loops never shorten a path, so rows leave them out
+            offsets.reserve(index.size() + 1);
+            offsets.push_back(0);
+            for ( vertex_t vertex : structure.viewVertices() ) {
+                typename ColumnarFeatureGraph<V, E>::id_view_t ids = graph.viewIncidentEdges(vertex);
+                const size_t * id = ids.begin();
+                for ( vertex_t neighbor : structure.viewNeighbors(vertex) ) {
+                    if ( neighbor != vertex ) {
+                        targets.push_back(index.indexOf(neighbor));
+                        weights.push_back(edge_weights[*id]);
+                    }
+                    id++;
+                }
+                offsets.push_back(targets.size());
+            }
+        }
+
+        void reset(size_t source) {
+            distances.assign(index.size(), std::numeric_limits<double>::infinity());
+            parents.assign(index.size(), size_t(VertexIndex::npos));
+            distances[source] = 0;
+            parents[source] = source;
+        }
+
+        // Average weight keeps buckets holding about one edge's worth of distance
+        double chooseDelta() const {
+            if ( delta > 0 ) { return delta; }
+            if ( weights.empty() ) { return 1; }
+
+            double total = 0;
+            for ( double weight : weights ) { total += weight; }
+            return total > 0 ? total / weights.size() : 1;
+        }
+
+    public:
+
+        explicit ShortestPaths(FeatureGraph<V, E> & graph,
+                               weight_t weight = [](const E & state) { return static_cast<double>(state); }) {
+            build(ColumnarFeatureGraph<V, E>(graph), weight);
+        }
+
+        explicit ShortestPaths(const ColumnarFeatureGraph<V, E> & graph,
+                               weight_t weight = [](const E & state) { return static_cast<double>(state); }) {
+            build(graph, weight);
+        }
+
+        // 0 threads means one per hardware thread
+        ShortestPaths& setThreads(size_t count) {
+            threads = count;
+            return *this;
+        }
+
+        // Bucket width for delta-stepping; 0 picks the average edge weight
+        ShortestPaths& setDelta(double width) {
+            delta = width;
+            return *this;
+        }
+
+        void dijkstra(vertex_t source) {
+            size_t start = validate(source);
+            reset(start);
+
+            QuaternaryHeap heap(index.size());
+            heap.push(start, 0);
+            while ( !heap.empty() ) {
+                size_t u = heap.pop();
+                double base = distances[u];
+                for ( size_t k = offsets[u]; k < offsets[u + 1]; k++ ) {
+                    size_t v = targets[k];
+                    double candidate = base + weights[k];
+                    if ( candidate < distances[v] ) {
+                        distances[v] = candidate;
+                        parents[v] = u;
+                        heap.push(v, candidate);
+                    }
+                }
+            }
+        }
+
+        // Buckets of width delta are settled in order. Within a bucket, light
+        // edges (weight at most delta) are relaxed from the whole frontier at
+        // once, split across threads with an atomic minimum on each distance,
+        // until the bucket stops refilling; heavy edges then go once from
+        // everything the bucket settled. Buckets live in a ring: an edge
+        // reaches at most ceil(heaviest / delta) buckets past the current one.
+        void deltaStepping(vertex_t source) {
+            size_t start = validate(source);
+            size_t n = index.size();
+            size_t workers = resolveThreads(threads);
+            double width = chooseDelta();
+
+            std::vector<std::atomic<double>> tentative(n);
+            for ( std::atomic<double> & distance : tentative ) {
+                distance.store(std::numeric_limits<double>::infinity(), std::memory_order_relaxed);
+            }
+            tentative[start].store(0, std::memory_order_relaxed);
+
+            // Infinite weights never relax anything
+            double heaviest = 0;
+            for ( double weight : weights ) {
+                if ( weight < std::numeric_limits<double>::infinity() ) { heaviest = std::max(heaviest, weight); }
+            }
+            std::vector<std::vector<size_t>> buckets(static_cast<size_t>(heaviest / width) + 3);
+            buckets[0].push_back(start);
+            size_t queued = 1;
+            std::vector<size_t> stamps(n, size_t(VertexIndex::npos));
+            std::vector<std::vector<size_t>> reached(workers);
+
+            auto bucketOf = [&](size_t v) {
+                return static_cast<size_t>(tentative[v].load(std::memory_order_relaxed) / width);
+            };
+
+            // Relax the chosen class of edges out of the frontier
+            auto relax = [&](const std::vector<size_t> & frontier, bool light) {
+                parallelFor(0, frontier.size(), frontier.size() < 256 ? 1 : workers, [&](size_t lo, size_t hi, size_t worker) {
+                    for ( size_t i = lo; i < hi; i++ ) {
+                        size_t u = frontier[i];
+                        double base = tentative[u].load(std::memory_order_relaxed);
+                        for ( size_t k = offsets[u]; k < offsets[u + 1]; k++ ) {
+                            if ( (weights[k] <= width) != light ) { continue; }
+
+                            size_t v = targets[k];
+                            double candidate = base + weights[k];
+                            double current = tentative[v].load(std::memory_order_relaxed);
+                            while ( candidate < current ) {
+                                if ( tentative[v].compare_exchange_weak(current, candidate, std::memory_order_relaxed) ) {
+                                    reached[worker].push_back(v);
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                });
+
+                for ( std::vector<size_t> & found : reached ) {
+                    for ( size_t v : found ) {
+                        buckets[bucketOf(v) % buckets.size()].push_back(v);
+                        queued++;
+                    }
+                    found.clear();
+                }
+            };
+
+            std::vector<size_t> frontier;
+            std::vector<size_t> settled;
+            for ( size_t i = 0; queued > 0; i++ ) {
+                std::vector<size_t> & bucket = buckets[i % buckets.size()];
+                settled.clear();
+                while ( !bucket.empty() ) {
+                    // Drop entries that moved to an earlier bucket or repeat
+                    frontier.clear();
+                    for ( size_t v : bucket ) {
+                        if ( bucketOf(v) == i && stamps[v] != i ) {
+                            stamps[v] = i;
+                            frontier.push_back(v);
+                        }
+                    }
+                    queued -= bucket.size();
+                    bucket.clear();
+
+                    // A vertex improved again within the bucket goes round again
+                    for ( size_t v : frontier ) { settled.push_back(v); }
+                    relax(frontier, true);
+                    for ( size_t v : bucket ) { stamps[v] = VertexIndex::npos; }
+                }
+
+                std::sort(settled.begin(), settled.end());
+                settled.erase(std::unique(settled.begin(), settled.end()), settled.end());
+                relax(settled, false);
+            }
+
+            reset(start);
+            for ( size_t v = 0; v < n; v++ ) { distances[v] = tentative[v].load(std::memory_order_relaxed); }
+
+            // Each distance is some neighbor's distance plus an edge weight,
+            // exactly. Zero weights can make such neighbors point at each
+            // other, so parents are taken in search order from the source
+            // over exact edges, which always leaves a tree.
+            frontier.assign(1, start);
+            for ( size_t i = 0; i < frontier.size(); i++ ) {
+                size_t u = frontier[i];
+                for ( size_t k = offsets[u]; k < offsets[u + 1]; k++ ) {
+                    size_t v = targets[k];
+                    if ( parents[v] == VertexIndex::npos && distances[u] + weights[k] == distances[v] ) {
+                        parents[v] = u;
+                        frontier.push_back(v);
+                    }
+                }
+            }
+        }
+
+        // Dijkstra from both ends, always growing the side with the smaller
+        // next key, until the two smallest keys add up to no less than the
+        // best meeting found; fills path (source first) when given
+        double bidirectional(vertex_t source, vertex_t target, std::vector<vertex_t> * path = nullptr) const {
+            size_t ends[2] = { validate(source), validate(target) };
+            size_t n = index.size();
+            double infinity = std::numeric_limits<double>::infinity();
+
+            std::vector<double> distance[2] = { std::vector<double>(n, infinity), std::vector<double>(n, infinity) };
+            std::vector<size_t> parent[2] = { std::vector<size_t>(n, size_t(VertexIndex::npos)), std::vector<size_t>(n, size_t(VertexIndex::npos)) };
+            QuaternaryHeap heaps[2] = { QuaternaryHeap(n), QuaternaryHeap(n) };
+            for ( size_t side = 0; side < 2; side++ ) {
+                distance[side][ends[side]] = 0;
+                parent[side][ends[side]] = ends[side];
+                heaps[side].push(ends[side], 0);
+            }
+
+            double best = ends[0] == ends[1] ? 0 : infinity;
+            size_t meeting = ends[0];
+            while ( !heaps[0].empty() && !heaps[1].empty() && heaps[0].topKey() + heaps[1].topKey() < best ) {
+                size_t side = heaps[0].topKey() <= heaps[1].topKey() ? 0 : 1;
+                size_t u = heaps[side].pop();
+                double base = distance[side][u];
+                for ( size_t k = offsets[u]; k < offsets[u + 1]; k++ ) {
+                    size_t v = targets[k];
+                    double candidate = base + weights[k];
+                    if ( candidate < distance[side][v] ) {
+                        distance[side][v] = candidate;
+                        parent[side][v] = u;
+                        heaps[side].push(v, candidate);
+                    }
+                    if ( candidate + distance[1 - side][v] < best ) {
+                        best = candidate + distance[1 - side][v];
+                        meeting = v;
+                    }
+                }
+            }
+
+            if ( path != nullptr ) {
+                path->clear();
+                if ( best < infinity ) {
+                    for ( size_t v = meeting; v != ends[0]; v = parent[0][v] ) { path->push_back(index.idOf(v)); }
+                    path->push_back(index.idOf(ends[0]));
+                    std::reverse(path->begin(), path->end());
+                    for ( size_t v = meeting; v != ends[1]; ) {
+                        v = parent[1][v];
+                        path->push_back(index.idOf(v));
+                    }
+                }
+            }
+
+            return best;
+        }
+
+        bool reached(vertex_t vertex) const {
+            return distances[validateResult(vertex)] < std::numeric_limits<double>::infinity();
+        }
+
+        // Distance from the last source, or infinity when unreachable
+        double getDistance(vertex_t vertex) const { return distances[validateResult(vertex)]; }
+
+        // Vertices from the last source to this one; empty when unreachable
+        std::vector<vertex_t> getPath(vertex_t vertex) const {
+            size_t v = validateResult(vertex);
+
+            std::vector<vertex_t> path;
+            if ( parents[v] == VertexIndex::npos ) { return path; }
+            while ( parents[v] != v ) {
+                path.push_back(index.idOf(v));
+                v = parents[v];
+            }
+            path.push_back(index.idOf(v));
+            std::reverse(path.begin(), path.end());
+
+            return path;
+        }
+
+    };
+
+}
+
+#endif //GRAPPH_SHORTESTPATHS_H
@@ -0,0 +1,100 @@
+#ifndef GRAPPH_SNAPSHOT_H
+#define GRAPPH_SNAPSHOT_H
+
+#include "Buffer.h"
+#include "ColumnarFeatureGraph.h"
+#include "CompactGraph.h"
+#include "FeatureGraph.h"
+#include "Graph.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace grapph {
+
+    // Versioned binary image of a CompactGraph, optionally followed by the
+    // state columns of a ColumnarFeatureGraph. A fixed header names each
+    // section's offset and length; sections are the raw arrays, aligned to
+    // 64 bytes. Loading maps the file and points the graph's arrays straight
+    // at the mapped pages: nothing is parsed or copied, and pages are read in
+    // on first touch. Mapped state columns are private to the process, so
+    // updates never reach the file. Snapshots are only portable between
+    // machines with the same byte order and word size, which load checks.
+    class Snapshot {
+
+    public:
+
+        static const uint32_t VERSION = 1;
+
+    private:
+
+        // Raw bytes of one state column
+        struct Column {
+            const void * data;
+            size_t bytes;
+        };
+
+        static void write(const std::string & path, const CompactGraph&, size_t vertex_state_size,
+                          size_t edge_state_size, const std::vector<Column> & columns);
+
+        // Map a snapshot and return its graph; when columns is set, the
+        // state columns are checked against the given sizes and returned too
+        static CompactGraph map(const std::string & path, size_t vertex_state_size, size_t edge_state_size,
+                                std::vector<Column> * columns, std::shared_ptr<const void> * owner);
+
+        template <typename T>
+        static Buffer<T> borrow(const Column & column, const std::shared_ptr<const void> & owner) {
+            return Buffer<T>(static_cast<T*>(const_cast<void*>(column.data)), column.bytes / sizeof(T), owner);
+        }
+
+    public:
+
+        static void save(const std::string & path, const CompactGraph & graph) { write(path, graph, 0, 0, {}); }
+        static void save(const std::string & path, Graph & graph) { save(path, CompactGraph(graph)); }
+
+        // States are written byte for byte, so they must be trivially copyable
+        template <typename V, typename E>
+        static void save(const std::string & path, const ColumnarFeatureGraph<V, E> & graph) {
+            static_assert(std::is_trivially_copyable<V>::value, "Vertex states must be trivially copyable");
+            static_assert(std::is_trivially_copyable<E>::value, "Edge states must be trivially copyable");
+
+            write(path, graph.graph, sizeof(V), sizeof(E), {
+                    { graph.vertex_states.data(), graph.vertex_states.size() * sizeof(V) },
+                    { graph.edge_list.data(), graph.edge_list.size() * sizeof(edge_t) },
+                    { graph.edge_states.data(), graph.edge_states.size() * sizeof(E) },
+                    { graph.slot_edges.data(), graph.slot_edges.size() * sizeof(size_t) } });
+        }
+
+        template <typename V, typename E>
+        static void save(const std::string & path, FeatureGraph<V, E> & graph) {
+            save(path, ColumnarFeatureGraph<V, E>(graph));
+        }
+
+        // Read-only graph over the mapped file; state columns, if any, are
+        // ignored. Throws if the file is missing or not a snapshot.
+        static CompactGraph load(const std::string & path) { return map(path, 0, 0, nullptr, nullptr); }
+
+        // Graph and state columns over the mapped file; throws unless the
+        // snapshot has columns of the same state sizes
+        template <typename V, typename E>
+        static ColumnarFeatureGraph<V, E> loadFeatures(const std::string & path) {
+            static_assert(std::is_trivially_copyable<V>::value, "Vertex states must be trivially copyable");
+            static_assert(std::is_trivially_copyable<E>::value, "Edge states must be trivially copyable");
+
+            std::vector<Column> columns;
+            std::shared_ptr<const void> owner;
+            CompactGraph graph = map(path, sizeof(V), sizeof(E), &columns, &owner);
+
+            return ColumnarFeatureGraph<V, E>(std::move(graph), borrow<V>(columns[0], owner),
+                                              borrow<E>(columns[2], owner), borrow<edge_t>(columns[1], owner),
+                                              borrow<size_t>(columns[3], owner));
+        }
+
+    };
+
+}
+
+#endif //GRAPPH_SNAPSHOT_H
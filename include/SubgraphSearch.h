@@ -0,0 +1,115 @@
+#ifndef GRAPPH_SUBGRAPHSEARCH_H
+#define GRAPPH_SUBGRAPHSEARCH_H
+
+#include "Bitset.h"
+#include "Graph.h"
+#include "Homomorphism.h"
+#include "VertexIndex.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace grapph {
+
+    enum class MatchKind {
+        HOMOMORPHISM,   // edges map to edges
+        MONOMORPHISM,   // ... and vertices map injectively
+        INDUCED         // ... and non-edges map to non-edges
+    };
+
+    // Finds vertex maps from a pattern graph into a target graph by
+    // backtracking over pattern vertices. Each pattern vertex starts from a
+    // bitset of target vertices passing the degree and self loop filters;
+    // pattern vertices are ordered so that each one after the first of its
+    // component has an already-mapped neighbor, whose target row supplies
+    // the candidates. With more than one thread the top of the search tree
+    // is split into tasks on per-worker deques that idle workers steal from.
+    // Both graphs must outlive the search and must not change during it.
+    class SubgraphSearch {
+
+    public:
+
+        // Return false to stop the search
+        typedef std::function<bool(const vfunc_t&)> callback_t;
+
+    private:
+
+        struct State;
+        struct TaskQueue;
+
+        Graph & pattern;
+        Graph & target;
+        MatchKind kind;
+
+        size_t threads = 1;
+        size_t limit = 0;
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(0);
+
+        VertexIndex pattern_index;
+        VertexIndex target_index;
+
+        // Target adjacency over dense positions
+        std::vector<size_t> target_offsets;
+        std::vector<size_t> target_neighbors;
+
+        std::vector<Bitset> pattern_adjacency;
+        std::vector<Bitset> domains;
+
+        // Pattern positions in search order; for each depth, the earlier
+        // depths whose pattern vertex is (not) adjacent to this one
+        std::vector<size_t> order;
+        std::vector<std::vector<size_t>> back_neighbors;
+        std::vector<std::vector<size_t>> back_non_neighbors;
+
+        // Per-run bookkeeping shared by all workers
+        std::atomic<bool> stopped;
+        std::atomic<bool> timed_out;
+        std::atomic<size_t> found;
+        size_t reported = 0;
+        std::chrono::steady_clock::time_point deadline;
+        std::mutex emit_mutex;
+
+        State makeState() const;
+
+        void prepare();
+        void chooseOrder();
+
+        bool targetAdjacent(size_t, size_t) const;
+        bool feasible(const State&, size_t depth, size_t candidate) const;
+        void candidates(State&, size_t depth) const;
+
+        bool tick(State&);
+        void emit(State&, const callback_t*);
+        void extend(State&, size_t depth, const callback_t*);
+        void runParallel(size_t workers, const callback_t*);
+        size_t run(const callback_t*);
+
+    public:
+
+        SubgraphSearch(Graph&, Graph&, MatchKind kind = MatchKind::MONOMORPHISM);
+
+        // 0 threads means one per hardware thread
+        SubgraphSearch& setThreads(size_t);
+        // Stop after this many matches; 0 means no limit
+        SubgraphSearch& setLimit(size_t);
+        // Stop once this much time has passed; 0 means no timeout
+        SubgraphSearch& setTimeout(std::chrono::milliseconds);
+
+        // Stream each match to the callback, which is never called
+        // concurrently; returns the number of matches reported
+        size_t enumerate(const callback_t&);
+        size_t count();
+        bool first(vfunc_t&);
+        std::vector<Homomorphism> find();
+
+        // Whether the last search stopped because of the timeout
+        bool timedOut() const { return timed_out.load(); }
+
+    };
+
+}
+
+#endif //GRAPPH_SUBGRAPHSEARCH_H
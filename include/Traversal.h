@@ -0,0 +1,184 @@
+#ifndef GRAPPH_TRAVERSAL_H
+#define GRAPPH_TRAVERSAL_H
+
+#include "CompactGraph.h"
+#include "DenseGraph.h"
+#include "Graph.h"
+#include "VertexIndex.h"
+
+#include <atomic>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace grapph {
+
+    // Called on each vertex as it is reached, with the vertex it was reached
+    // from (the source is its own parent) and its depth; return false to stop
+    typedef std::function<bool(vertex_t vertex, vertex_t parent, size_t depth)> visitor_t;
+
+    // Serial traversals from a source over any graph with viewVertices and
+    // viewNeighbors (Graph, CompactGraph, DenseGraph); rows are walked in
+    // place, never copied. Both return the number of vertices visited.
+
+    template <typename G>
+    size_t breadthFirst(const G & graph, vertex_t source, const visitor_t & visit) {
+        VertexIndex index(graph.viewVertices().begin(), graph.viewVertices().end());
+        // Throws for a missing source
+        graph.viewNeighbors(source);
+
+        std::vector<bool> seen(index.size(), false);
+        std::vector<std::pair<vertex_t, size_t>> queue = { { source, 0 } };
+        seen[index.indexOf(source)] = true;
+        if ( !visit(source, source, 0) ) { return 1; }
+
+        for ( size_t head = 0; head < queue.size(); head++ ) {
+            vertex_t vertex = queue[head].first;
+            size_t depth = queue[head].second + 1;
+            for ( vertex_t neighbor : graph.viewNeighbors(vertex) ) {
+                size_t position = index.indexOf(neighbor);
+                if ( seen[position] ) { continue; }
+
+                seen[position] = true;
+                queue.push_back({ neighbor, depth });
+                if ( !visit(neighbor, vertex, depth) ) { return queue.size(); }
+            }
+        }
+
+        return queue.size();
+    }
+
+    // Visits in preorder; the stack holds a cursor into each open row along
+    // with the row's end, so each row is looked up once and deep graphs do
+    // not recurse
+    template <typename G>
+    size_t depthFirst(const G & graph, vertex_t source, const visitor_t & visit) {
+        typedef decltype(graph.viewNeighbors(source).begin()) cursor_t;
+
+        struct Frame {
+            vertex_t vertex;
+            cursor_t cursor;
+            cursor_t end;
+        };
+
+        auto open = [&graph](vertex_t vertex) {
+            const auto & row = graph.viewNeighbors(vertex);
+            return Frame{ vertex, row.begin(), row.end() };
+        };
+
+        VertexIndex index(graph.viewVertices().begin(), graph.viewVertices().end());
+        // Throws for a missing source
+        Frame first = open(source);
+
+        std::vector<bool> seen(index.size(), false);
+        std::vector<Frame> stack;
+        seen[index.indexOf(source)] = true;
+        size_t visited = 1;
+        if ( !visit(source, source, 0) ) { return visited; }
+        stack.push_back(first);
+
+        while ( !stack.empty() ) {
+            Frame & frame = stack.back();
+            if ( frame.cursor == frame.end ) {
+                stack.pop_back();
+                continue;
+            }
+
+            vertex_t vertex = frame.vertex;
+            vertex_t neighbor = *frame.cursor++;
+            size_t position = index.indexOf(neighbor);
+            if ( seen[position] ) { continue; }
+
+            seen[position] = true;
+            visited++;
+            if ( !visit(neighbor, vertex, stack.size()) ) { return visited; }
+            stack.push_back(open(neighbor));
+        }
+
+        return visited;
+    }
+
+    // Level-synchronous breadth-first search split across threads. Levels
+    // expand top-down (each frontier vertex claims its unreached neighbors)
+    // while the frontier is small, and bottom-up (each unreached vertex looks
+    // for a neighbor in the frontier bitset) once the frontier's edges
+    // outweigh the unexplored ones, switching back as the frontier thins out.
+    // The graph is copied into position-indexed rows on construction, so one
+    // instance serves any number of searches.
+    class ParallelBfs {
+
+    public:
+
+        // Called between levels with the vertices the level just reached
+        typedef std::function<void(size_t depth, const std::vector<vertex_t>&)> level_visitor_t;
+
+        static const size_t npos = static_cast<size_t>(-1);
+
+    private:
+
+        VertexIndex index;
+
+        // Rows over positions, without self loops; loops only count
+        // towards edges traversed
+        std::vector<size_t> offsets;
+        std::vector<size_t> neighbors;
+        std::vector<bool> loops;
+
+        size_t threads = 0;
+        size_t alpha = 15;
+        size_t beta = 18;
+
+        // Per-position results of the last run
+        std::vector<size_t> depths;
+        std::vector<std::atomic<size_t>> parents;
+        size_t num_reached = 0;
+        size_t num_levels = 0;
+        size_t bottom_up_levels = 0;
+        size_t edges_traversed = 0;
+
+        size_t validate(vertex_t) const;
+
+        template <typename G>
+        void build(const G&);
+
+        // Replace the frontier with the positions the next level reaches
+        void topDown(std::vector<size_t> & frontier, size_t depth, size_t workers);
+        void bottomUp(std::vector<size_t> & frontier, size_t depth, size_t workers);
+
+    public:
+
+        explicit ParallelBfs(const Graph&);
+        explicit ParallelBfs(const CompactGraph&);
+        explicit ParallelBfs(const DenseGraph&);
+
+        // 0 threads means one per hardware thread
+        ParallelBfs& setThreads(size_t);
+        // Go bottom-up once frontier edges * alpha exceed the unexplored
+        // edges; 0 keeps every level top-down
+        ParallelBfs& setAlpha(size_t);
+        // Go back top-down once frontier size * beta falls below the vertex
+        // count; 0 never goes back
+        ParallelBfs& setBeta(size_t);
+
+        // Search from the source, replacing the previous results; returns the
+        // number of vertices reached
+        size_t run(vertex_t source, const level_visitor_t & visit = nullptr);
+
+        bool reached(vertex_t) const;
+        // Depth of a vertex, or npos if it was not reached
+        size_t getDepth(vertex_t) const;
+        // Vertex a reached vertex was claimed from; the source is its own
+        // parent. Throws for unreached vertices.
+        vertex_t getParent(vertex_t) const;
+
+        size_t getNumReached() const { return num_reached; }
+        size_t getNumLevels() const { return num_levels; }
+        size_t getNumBottomUpLevels() const { return bottom_up_levels; }
+        // Edges with an endpoint reached, the numerator of TEPS
+        size_t getEdgesTraversed() const { return edges_traversed; }
+
+    };
+
+}
+
+#endif //GRAPPH_TRAVERSAL_H
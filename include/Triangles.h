@@ -0,0 +1,60 @@
+#ifndef GRAPPH_TRIANGLES_H
+#define GRAPPH_TRIANGLES_H
+
+#include "CompactGraph.h"
+#include "DenseGraph.h"
+#include "Graph.h"
+#include "SetFunctions.h"
+#include "VertexIndex.h"
+
+#include <vector>
+
+namespace grapph {
+
+    // Triangle counts and clustering coefficients of a graph at one point in
+    // time. Every edge is oriented from the endpoint of lower degree to the
+    // higher one (ties by position), which leaves each vertex O(sqrt(m))
+    // outgoing edges; a triangle is then found exactly once, at its lowest
+    // corner, by intersecting the sorted outgoing rows of an edge's two ends
+    // with the sorted array kernels. Self loops are ignored.
+    class Triangles {
+
+    private:
+
+        VertexIndex index;
+
+        // Per position, loops excluded
+        std::vector<size_t> degrees;
+        std::vector<size_t> counts;
+
+        size_t num_triangles = 0;
+
+        size_t validate(vertex_t) const;
+
+        template <typename G>
+        void compute(const G&, size_t threads, SimdLevel level);
+
+    public:
+
+        // 0 threads means one per hardware thread
+        explicit Triangles(const Graph&, size_t threads = 1, SimdLevel level = SimdLevel::AUTO);
+        explicit Triangles(const CompactGraph&, size_t threads = 1, SimdLevel level = SimdLevel::AUTO);
+        explicit Triangles(const DenseGraph&, size_t threads = 1, SimdLevel level = SimdLevel::AUTO);
+
+        size_t getNumTriangles() const { return num_triangles; }
+        // Triangles the vertex is a corner of
+        size_t getTriangles(vertex_t) const;
+
+        // Share of the vertex's neighbor pairs that are adjacent; 0 below
+        // degree 2
+        double getLocalClustering(vertex_t) const;
+        // Mean of the local coefficients over all vertices
+        double getAverageClustering() const;
+        // Closed paths of length two over all of them (transitivity)
+        double getGlobalClustering() const;
+
+    };
+
+}
+
+#endif //GRAPPH_TRIANGLES_H
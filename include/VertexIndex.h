@@ -0,0 +1,61 @@
+#ifndef GRAPPH_VERTEXINDEX_H
+#define GRAPPH_VERTEXINDEX_H
+
+#include "Buffer.h"
+#include "Graph.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace grapph {
+
+    // Maps (possibly sparse) sorted vertex ids to dense positions 0..n-1 and back;
+    // when the ids are exactly 0..n-1 lookups skip the binary search
+    class VertexIndex {
+
+        friend class Snapshot;
+
+    private:
+
+        Buffer<vertex_t> ids;
+        bool identity = true;
+
+        // Adopt ids whose identity flag is already known
+        VertexIndex(Buffer<vertex_t> ids, bool identity) : ids(std::move(ids)), identity(identity) {}
+
+    public:
+
+        static const size_t npos = static_cast<size_t>(-1);
+
+        VertexIndex() = default;
+
+        // Ids must be sorted and unique, as they are when read out of a Graph
+        template <typename Iterator>
+        VertexIndex(Iterator begin, Iterator end) : ids(std::vector<vertex_t>(begin, end)) {
+            for ( size_t i = 0; i < ids.size(); i++ ) {
+                if ( ids[i] != i ) { identity = false; break; }
+            }
+        }
+
+        size_t size() const { return ids.size(); }
+        bool isIdentity() const { return identity; }
+
+        size_t indexOf(vertex_t vertex) const {
+            if ( identity ) { return vertex < ids.size() ? vertex : npos; }
+
+            auto it = std::lower_bound(ids.begin(), ids.end(), vertex);
+            if ( it == ids.end() || *it != vertex ) { return npos; }
+            return it - ids.begin();
+        }
+
+        bool contains(vertex_t vertex) const { return indexOf(vertex) != npos; }
+
+        vertex_t idOf(size_t index) const { return ids[index]; }
+
+        const Buffer<vertex_t>& getIds() const { return ids; }
+
+    };
+
+}
+
+#endif //GRAPPH_VERTEXINDEX_H
@@ -0,0 +1,37 @@
+#ifndef GRAPPH_BENCHGRAPHS_H
+#define GRAPPH_BENCHGRAPHS_H
+
+#include "Graph.h"
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Synthetic inputs shared by the benchmarks
+
+// Roughly n * degree / 2 distinct random edges over vertices 0..n-1, unsorted
+inline std::vector<grapph::edge_t> randomEdgeList(size_t n, size_t degree) {
+    std::mt19937_64 rng(n * 31 + degree);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, n - 1);
+
+    std::set<grapph::edge_t> seen;
+    std::vector<grapph::edge_t> edges;
+    while ( edges.size() < n * degree / 2 ) {
+        grapph::vertex_t u = pick(rng);
+        grapph::vertex_t w = pick(rng);
+        if ( u == w ) { continue; }
+        if ( seen.insert({ std::min(u, w), std::max(u, w) }).second ) { edges.push_back({ u, w }); }
+    }
+
+    return edges;
+}
+
+inline grapph::Graph randomGraph(size_t n, size_t degree) {
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.insert(vertices.end(), u); }
+
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(n, degree);
+    return grapph::Graph(vertices, std::set<grapph::edge_t>(edge_list.begin(), edge_list.end()));
+}
+
+#endif //GRAPPH_BENCHGRAPHS_H
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+
+#include "Bitset.h"
+
+TEST(BitsetTest, TestSetAndScan) {
+    // Bits on both sides of word boundaries
+    grapph::Bitset bits(130);
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(129);
+
+    // Assertions
+    ASSERT_EQ(130, bits.size());
+    ASSERT_EQ(4, bits.count());
+    ASSERT_TRUE(bits.test(63));
+    ASSERT_FALSE(bits.test(62));
+    ASSERT_EQ(0, bits.findFirst());
+    ASSERT_EQ(63, bits.findNext(0));
+    ASSERT_EQ(64, bits.findNext(63));
+    ASSERT_EQ(129, bits.findNext(64));
+    ASSERT_TRUE(bits.findNext(129) == grapph::Bitset::npos);
+
+    bits.reset(0);
+    ASSERT_EQ(63, bits.findFirst());
+    bits.clear();
+    ASSERT_TRUE(bits.none());
+    ASSERT_TRUE(bits.findFirst() == grapph::Bitset::npos);
+}
+
+TEST(BitsetTest, TestSetOperations) {
+    // Full and partial sets that do not end on a word boundary
+    grapph::Bitset full(70, true);
+    grapph::Bitset evens(70);
+    for ( size_t i = 0; i < 70; i += 2 ) { evens.set(i); }
+
+    // Assertions
+    ASSERT_EQ(70, full.count());
+    ASSERT_EQ(35, full.intersectionCount(evens));
+
+    grapph::Bitset odds = full;
+    odds.subtract(evens);
+    ASSERT_EQ(35, odds.count());
+    ASSERT_EQ(1, odds.findFirst());
+    ASSERT_EQ(0, grapph::Bitset(odds).intersect(evens).count());
+    ASSERT_EQ(full, grapph::Bitset(odds).unite(evens));
+    ASSERT_NE(full, odds);
+}
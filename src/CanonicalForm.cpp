@@ -0,0 +1,362 @@
+#include "CanonicalForm.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    namespace {
+
+        uint64_t mix(uint64_t seed, uint64_t value) {
+            // splitmix64 finalizer over the combined value
+            uint64_t z = seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            return z ^ (z >> 31);
+        }
+
+        // Colors are cell start positions in the ordered partition, so the
+        // vertices of color c and size s hold ranks c..c+s-1
+        typedef std::vector<size_t> coloring_t;
+
+        class Search {
+
+        private:
+
+            const std::vector<std::vector<size_t>> & rows;
+            size_t n;
+
+            // Best leaf so far, ordered by trace and then by certificate
+            bool have_best = false;
+            std::vector<uint64_t> best_trace;
+            std::vector<edge_t> best_certificate;
+            coloring_t best_labels;
+            std::vector<size_t> best_positions;
+
+            std::vector<uint64_t> trace;
+            std::vector<size_t> path;
+
+            // Generating automorphisms, as position permutations. One is
+            // kept only if it joined orbits at some open level, so the many
+            // automorphisms the group already generates are dropped.
+            std::vector<std::vector<size_t>> automorphisms;
+
+            // Orbit partition of each open level, as union-find parents over
+            // positions, under the kept automorphisms that fix the vertices
+            // individualized above that level
+            std::vector<std::vector<size_t>> level_orbits;
+
+            size_t findOrbit(size_t level, size_t v) {
+                std::vector<size_t> & parent = level_orbits[level];
+                while ( parent[v] != v ) { v = parent[v] = parent[parent[v]]; }
+                return v;
+            }
+
+            // Join the cycles of automorphism in the level's partition;
+            // true if any two orbits merged
+            bool joinOrbits(size_t level, const std::vector<size_t> & automorphism) {
+                bool merged = false;
+                for ( size_t v = 0; v < n; v++ ) {
+                    size_t a = findOrbit(level, v);
+                    size_t b = findOrbit(level, automorphism[v]);
+                    if ( a != b ) {
+                        level_orbits[level][std::max(a, b)] = std::min(a, b);
+                        merged = true;
+                    }
+                }
+                return merged;
+            }
+
+            void openLevel() {
+                size_t level = level_orbits.size();
+                level_orbits.emplace_back(n);
+                std::iota(level_orbits[level].begin(), level_orbits[level].end(), 0);
+                for ( const std::vector<size_t> & automorphism : automorphisms ) {
+                    bool fixes_path = true;
+                    for ( size_t v : path ) {
+                        if ( automorphism[v] != v ) { fixes_path = false; break; }
+                    }
+                    if ( fixes_path ) { joinOrbits(level, automorphism); }
+                }
+            }
+
+            size_t countCells(const coloring_t & color) const {
+                std::vector<bool> start(n, false);
+                for ( size_t c : color ) { start[c] = true; }
+                return std::count(start.begin(), start.end(), true);
+            }
+
+            // Split cells by the multiset of neighbor colors until stable
+            void refine(coloring_t & color) const {
+                size_t cells = countCells(color);
+                std::vector<std::vector<size_t>> signature(n);
+                std::vector<size_t> order(n);
+                while ( cells < n ) {
+                    for ( size_t v = 0; v < n; v++ ) {
+                        signature[v].clear();
+                        for ( size_t w : rows[v] ) { signature[v].push_back(color[w]); }
+                        std::sort(signature[v].begin(), signature[v].end());
+                    }
+
+                    std::iota(order.begin(), order.end(), 0);
+                    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+                        if ( color[a] != color[b] ) { return color[a] < color[b]; }
+                        return signature[a] < signature[b];
+                    });
+
+                    coloring_t refined(n);
+                    size_t refined_cells = 0;
+                    for ( size_t i = 0; i < n; i++ ) {
+                        size_t v = order[i];
+                        if ( i == 0 || color[v] != color[order[i - 1]] || signature[v] != signature[order[i - 1]] ) {
+                            refined[v] = i;
+                            refined_cells++;
+                        } else {
+                            refined[v] = refined[order[i - 1]];
+                        }
+                    }
+
+                    color.swap(refined);
+                    if ( refined_cells == cells ) { break; }
+                    cells = refined_cells;
+                }
+            }
+
+            uint64_t traceOf(const coloring_t & color) const {
+                // Cell sizes in cell order do not depend on vertex names
+                std::vector<size_t> sizes(n, 0);
+                for ( size_t c : color ) { sizes[c]++; }
+
+                uint64_t value = n;
+                for ( size_t c = 0; c < n; c++ ) {
+                    if ( sizes[c] != 0 ) { value = mix(mix(value, c), sizes[c]); }
+                }
+                return value;
+            }
+
+            // Negative, zero or positive as the current trace prefix compares
+            // to the best leaf's; a longer trace with an equal prefix is worse
+            int compareTrace() const {
+                size_t common = std::min(trace.size(), best_trace.size());
+                for ( size_t i = 0; i < common; i++ ) {
+                    if ( trace[i] != best_trace[i] ) { return trace[i] < best_trace[i] ? -1 : 1; }
+                }
+                return trace.size() > best_trace.size() ? 1 : 0;
+            }
+
+            std::vector<edge_t> certificate(const coloring_t & color) const {
+                std::vector<edge_t> relabeled;
+                for ( size_t v = 0; v < n; v++ ) {
+                    for ( size_t w : rows[v] ) {
+                        if ( v <= w ) { relabeled.push_back({ std::min(color[v], color[w]), std::max(color[v], color[w]) }); }
+                    }
+                }
+                std::sort(relabeled.begin(), relabeled.end());
+
+                return relabeled;
+            }
+
+            void leaf(const coloring_t & color) {
+                std::vector<edge_t> relabeled = certificate(color);
+                int order = have_best ? compareTrace() : -1;
+                if ( order == 0 ) {
+                    if ( relabeled < best_certificate ) { order = -1; }
+                    else if ( best_certificate < relabeled ) { order = 1; }
+                }
+
+                if ( order < 0 ) {
+                    have_best = true;
+                    best_trace = trace;
+                    best_certificate.swap(relabeled);
+                    best_labels = color;
+                    best_positions.assign(n, 0);
+                    for ( size_t v = 0; v < n; v++ ) { best_positions[color[v]] = v; }
+                } else if ( order == 0 ) {
+                    // Same relabeled graph from a different leaf: the map
+                    // taking this leaf onto the best one is an automorphism;
+                    // join its cycles in every level whose path it fixes
+                    std::vector<size_t> automorphism(n);
+                    for ( size_t v = 0; v < n; v++ ) { automorphism[v] = best_positions[color[v]]; }
+                    bool merged = false;
+                    for ( size_t level = 0; level < level_orbits.size(); level++ ) {
+                        if ( level > 0 && automorphism[path[level - 1]] != path[level - 1] ) { break; }
+                        merged = joinOrbits(level, automorphism) || merged;
+                    }
+                    if ( merged ) { automorphisms.push_back(std::move(automorphism)); }
+                }
+            }
+
+            void visit(coloring_t color) {
+                refine(color);
+                trace.push_back(traceOf(color));
+
+                if ( have_best && compareTrace() > 0 ) {
+                    trace.pop_back();
+                    return;
+                }
+
+                // First non-singleton cell, if any
+                std::vector<size_t> sizes(n, 0);
+                for ( size_t c : color ) { sizes[c]++; }
+                size_t target = 0;
+                while ( target < n && sizes[target] <= 1 ) { target++; }
+
+                if ( target == n ) {
+                    leaf(color);
+                    trace.pop_back();
+                    return;
+                }
+
+                std::vector<size_t> cell;
+                for ( size_t v = 0; v < n; v++ ) {
+                    if ( color[v] == target ) { cell.push_back(v); }
+                }
+
+                // Individualize each vertex of the cell, skipping vertices an
+                // automorphism fixing the path maps onto an explored one
+                size_t level = path.size();
+                openLevel();
+                std::vector<size_t> explored;
+                for ( size_t v : cell ) {
+                    bool equivalent = false;
+                    for ( size_t w : explored ) {
+                        if ( findOrbit(level, w) == findOrbit(level, v) ) { equivalent = true; break; }
+                    }
+                    if ( equivalent ) { continue; }
+
+                    coloring_t child = color;
+                    for ( size_t w : cell ) {
+                        if ( w != v ) { child[w] = target + 1; }
+                    }
+                    path.push_back(v);
+                    visit(std::move(child));
+                    path.pop_back();
+                    explored.push_back(v);
+                }
+
+                level_orbits.pop_back();
+                trace.pop_back();
+            }
+
+        public:
+
+            explicit Search(const std::vector<std::vector<size_t>> & rows) : rows(rows), n(rows.size()) {}
+
+            void run(const coloring_t & initial) {
+                visit(initial);
+            }
+
+            const coloring_t& getLabels() const { return best_labels; }
+            const std::vector<size_t>& getPositions() const { return best_positions; }
+            const std::vector<edge_t>& getCertificate() const { return best_certificate; }
+
+        };
+
+    }
+
+    CanonicalForm::CanonicalForm(Graph & graph)
+            : index(graph.viewVertices().begin(), graph.viewVertices().end()) {
+        size_t n = index.size();
+
+        // Adjacency over dense positions; a self loop lists the vertex itself
+        std::vector<std::vector<size_t>> rows(n);
+        std::vector<bool> loop(n, false);
+        size_t position = 0;
+        for ( vertex_t vertex : graph.viewVertices() ) {
+            for ( vertex_t neighbor : graph.viewNeighbors(vertex) ) {
+                rows[position].push_back(index.indexOf(neighbor));
+                if ( neighbor == vertex ) { loop[position] = true; }
+            }
+            position++;
+        }
+
+        // Start from two cells: vertices without and with self loops
+        size_t loopless = std::count(loop.begin(), loop.end(), false);
+        std::vector<size_t> initial(n);
+        for ( size_t v = 0; v < n; v++ ) { initial[v] = loop[v] ? loopless : 0; }
+
+        Search search(rows);
+        search.run(initial);
+        labels = search.getLabels();
+        positions = search.getPositions();
+        edges = search.getCertificate();
+
+        hash = mix(0, n);
+        for ( const edge_t & edge : edges ) { hash = mix(mix(hash, edge.first), edge.second); }
+    }
+
+    vertex_t CanonicalForm::getLabel(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss << "Vertex " << vertex << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return labels[position];
+    }
+
+    vertex_t CanonicalForm::getVertex(vertex_t label) const {
+        if ( label >= positions.size() ) {
+            std::stringstream ss;
+            ss << "Label " << label << " out of range";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return index.idOf(positions[label]);
+    }
+
+    Graph CanonicalForm::toGraph() const {
+        std::set<vertex_t> vertex_set;
+        for ( vertex_t label = 0; label < labels.size(); label++ ) { vertex_set.insert(vertex_set.end(), label); }
+
+        return Graph(vertex_set, std::set<edge_t>(edges.begin(), edges.end()));
+    }
+
+    bool CanonicalForm::isIsomorphic(Graph & a, Graph & b) {
+        // Cheap invariants first
+        if ( a.viewVertices().size() != b.viewVertices().size()
+                || a.viewEdges().size() != b.viewEdges().size() ) {
+            return false;
+        }
+
+        std::vector<size_t> a_degrees;
+        std::vector<size_t> b_degrees;
+        for ( vertex_t vertex : a.viewVertices() ) { a_degrees.push_back(a.viewNeighbors(vertex).size()); }
+        for ( vertex_t vertex : b.viewVertices() ) { b_degrees.push_back(b.viewNeighbors(vertex).size()); }
+        std::sort(a_degrees.begin(), a_degrees.end());
+        std::sort(b_degrees.begin(), b_degrees.end());
+        if ( a_degrees != b_degrees ) { return false; }
+
+        return CanonicalForm(a) == CanonicalForm(b);
+    }
+
+    Homomorphism CanonicalForm::findIsomorphism(Graph & a, Graph & b) {
+        CanonicalForm a_form(a);
+        CanonicalForm b_form(b);
+        if ( a_form != b_form ) {
+            throw std::invalid_argument("Graphs are not isomorphic");
+        }
+
+        // Send each vertex to the vertex carrying the same canonical label
+        vfunc_t vertex_map;
+        for ( vertex_t vertex : a.viewVertices() ) {
+            vertex_map.emplace_hint(vertex_map.end(), vertex, b_form.getVertex(a_form.getLabel(vertex)));
+        }
+
+        return Homomorphism(a, b, vertex_map);
+    }
+
+    std::vector<uint64_t> CanonicalForm::hashAll(std::vector<Graph> & graphs, size_t threads) {
+        std::vector<uint64_t> hashes(graphs.size());
+        parallelFor(0, graphs.size(), threads, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t i = lo; i < hi; i++ ) { hashes[i] = CanonicalForm(graphs[i]).getHash(); }
+        });
+
+        return hashes;
+    }
+
+}
@@ -0,0 +1,48 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "CanonicalForm.h"
+
+// A batch of small random graphs, the deduplication workload
+static std::vector<grapph::Graph> randomBatch(size_t count, size_t n, size_t degree) {
+    std::vector<grapph::Graph> graphs;
+    for ( size_t i = 0; i < count; i++ ) {
+        std::vector<grapph::edge_t> edge_list = randomEdgeList(n, degree);
+        std::shuffle(edge_list.begin(), edge_list.end(), std::mt19937_64(i));
+        edge_list.resize(edge_list.size() - i % 4);
+
+        std::set<grapph::vertex_t> vertices;
+        for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.insert(vertices.end(), u); }
+        std::set<grapph::edge_t> edges;
+        for ( const grapph::edge_t & edge : edge_list ) {
+            edges.insert({ std::min(edge.first, edge.second), std::max(edge.first, edge.second) });
+        }
+        graphs.push_back(grapph::Graph(vertices, edges));
+    }
+
+    return graphs;
+}
+
+static void BM_CanonicalHashAll(benchmark::State & state) {
+    std::vector<grapph::Graph> graphs = randomBatch(state.range(0), state.range(1), 4);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::CanonicalForm::hashAll(graphs, state.range(2)));
+    }
+    state.SetItemsProcessed(state.iterations() * graphs.size());
+}
+BENCHMARK(BM_CanonicalHashAll)->Args({1000, 12, 1})->Args({1000, 12, 0})->Unit(benchmark::kMillisecond);
+
+static void BM_CanonicalFormCycle(benchmark::State & state) {
+    // Vertex-transitive, so everything rests on automorphism pruning
+    grapph::Graph cycle;
+    for ( grapph::vertex_t u = 0; u < static_cast<size_t>(state.range(0)); u++ ) { cycle.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < static_cast<size_t>(state.range(0)); u++ ) {
+        cycle.addEdge(u, (u + 1) % state.range(0));
+    }
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::CanonicalForm(cycle).getHash());
+    }
+}
+BENCHMARK(BM_CanonicalFormCycle)->Arg(64)->Arg(256)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,161 @@
+#include "gtest/gtest.h"
+
+#include "CanonicalForm.h"
+#include "Graph.h"
+
+#include <algorithm>
+#include <random>
+
+static grapph::Graph petersen() {
+    grapph::Graph graph;
+    for ( grapph::vertex_t u = 0; u < 10; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < 5; u++ ) {
+        graph.addEdge(u, (u + 1) % 5);
+        graph.addEdge(u, u + 5);
+        graph.addEdge(u + 5, (u + 2) % 5 + 5);
+    }
+
+    return graph;
+}
+
+// Copy of a graph under a random renaming onto sparse ids
+static grapph::Graph shuffled(grapph::Graph & graph, unsigned seed) {
+    std::vector<grapph::vertex_t> names;
+    for ( grapph::vertex_t u = 0; u < graph.getVertices().size(); u++ ) { names.push_back(3 * u + 7); }
+    std::shuffle(names.begin(), names.end(), std::mt19937(seed));
+
+    std::set<grapph::vertex_t> vertices(names.begin(), names.end());
+    std::set<grapph::edge_t> edges;
+    for ( const grapph::edge_t & edge : graph.getEdges() ) {
+        grapph::vertex_t a = names[edge.first];
+        grapph::vertex_t b = names[edge.second];
+        edges.insert({ std::min(a, b), std::max(a, b) });
+    }
+
+    return grapph::Graph(vertices, edges);
+}
+
+TEST(CanonicalFormTest, TestRelabeledPetersen) {
+    grapph::Graph graph = petersen();
+    grapph::CanonicalForm form(graph);
+
+    // Assertions
+    for ( unsigned seed = 1; seed <= 5; seed++ ) {
+        grapph::Graph renamed = shuffled(graph, seed);
+        grapph::CanonicalForm renamed_form(renamed);
+        ASSERT_TRUE(form == renamed_form);
+        ASSERT_EQ(form.getHash(), renamed_form.getHash());
+        ASSERT_TRUE(grapph::CanonicalForm::isIsomorphic(graph, renamed));
+
+        grapph::Homomorphism isomorphism = grapph::CanonicalForm::findIsomorphism(graph, renamed);
+        ASSERT_TRUE(isomorphism.isBijective());
+    }
+
+    grapph::Graph canonical = form.toGraph();
+    ASSERT_EQ(15, canonical.getEdges().size());
+    ASSERT_TRUE(grapph::CanonicalForm::isIsomorphic(graph, canonical));
+}
+
+TEST(CanonicalFormTest, TestNonIsomorphic) {
+    // Both 2-regular on six vertices
+    grapph::Graph hexagon({ 0, 1, 2, 3, 4, 5 }, { { 0, 1 }, { 1, 2 }, { 2, 3 },
+                                                  { 3, 4 }, { 4, 5 }, { 5, 0 } });
+    grapph::Graph triangles({ 0, 1, 2, 3, 4, 5 }, { { 0, 1 }, { 1, 2 }, { 2, 0 },
+                                                    { 3, 4 }, { 4, 5 }, { 5, 3 } });
+
+    // Assertions
+    ASSERT_FALSE(grapph::CanonicalForm::isIsomorphic(hexagon, triangles));
+    ASSERT_TRUE(grapph::CanonicalForm(hexagon) != grapph::CanonicalForm(triangles));
+    ASSERT_THROW(grapph::CanonicalForm::findIsomorphism(hexagon, triangles), std::invalid_argument);
+
+    // Self loops are part of the structure
+    grapph::Graph looped_end({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 0, 0 } });
+    grapph::Graph looped_middle({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 1, 1 } });
+    grapph::Graph looped_other_end({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 2, 2 } });
+    ASSERT_FALSE(grapph::CanonicalForm::isIsomorphic(looped_end, looped_middle));
+    ASSERT_TRUE(grapph::CanonicalForm::isIsomorphic(looped_end, looped_other_end));
+}
+
+TEST(CanonicalFormTest, TestLabels) {
+    grapph::Graph path({ 10, 20, 30 }, { { 10, 20 }, { 20, 30 } });
+    grapph::CanonicalForm form(path);
+
+    // Assertions
+    ASSERT_EQ(3, form.getNumVertices());
+    for ( grapph::vertex_t vertex : path.getVertices() ) {
+        ASSERT_EQ(vertex, form.getVertex(form.getLabel(vertex)));
+    }
+    ASSERT_THROW(form.getLabel(15), std::invalid_argument);
+    ASSERT_THROW(form.getVertex(3), std::invalid_argument);
+
+    grapph::Graph empty;
+    ASSERT_EQ(0, grapph::CanonicalForm(empty).getNumVertices());
+    ASSERT_TRUE(grapph::CanonicalForm::isIsomorphic(empty, empty));
+}
+
+TEST(CanonicalFormTest, TestHashAllFourVertexGraphs) {
+    // All 64 labeled graphs on four vertices
+    std::vector<grapph::edge_t> pairs = { { 0, 1 }, { 0, 2 }, { 0, 3 }, { 1, 2 }, { 1, 3 }, { 2, 3 } };
+    std::vector<grapph::Graph> graphs;
+    for ( size_t mask = 0; mask < 64; mask++ ) {
+        std::set<grapph::edge_t> edges;
+        for ( size_t bit = 0; bit < 6; bit++ ) {
+            if ( mask & (1 << bit) ) { edges.insert(pairs[bit]); }
+        }
+        graphs.push_back(grapph::Graph({ 0, 1, 2, 3 }, edges));
+    }
+
+    std::vector<uint64_t> serial = grapph::CanonicalForm::hashAll(graphs);
+    std::vector<uint64_t> parallel = grapph::CanonicalForm::hashAll(graphs, 4);
+
+    // Assertions: there are 11 graphs on four vertices up to isomorphism
+    ASSERT_EQ(serial, parallel);
+    ASSERT_EQ(11, std::set<uint64_t>(serial.begin(), serial.end()).size());
+}
+
+TEST(CanonicalFormTest, TestRelabeledHypercube) {
+    // Four-dimensional hypercube, vertex-transitive with 384 automorphisms
+    grapph::Graph cube;
+    for ( grapph::vertex_t u = 0; u < 16; u++ ) { cube.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < 16; u++ ) {
+        for ( grapph::vertex_t bit = 1; bit < 16; bit <<= 1 ) {
+            if ( (u ^ bit) > u ) { cube.addEdge(u, u ^ bit); }
+        }
+    }
+
+    // Assertions
+    grapph::CanonicalForm form(cube);
+    for ( unsigned seed = 1; seed <= 5; seed++ ) {
+        grapph::Graph renamed = shuffled(cube, seed);
+        ASSERT_TRUE(form == grapph::CanonicalForm(renamed));
+    }
+
+    grapph::Graph broken = shuffled(cube, 9);
+    grapph::edge_t edge = *broken.getEdges().begin();
+    broken.removeEdge(edge);
+    ASSERT_FALSE(grapph::CanonicalForm::isIsomorphic(cube, broken));
+}
+
+TEST(CanonicalFormTest, TestHugeAutomorphismGroups) {
+    // Twelve disjoint triangles and twenty isolated vertices: a group of
+    // 6^12 * 12! * 20! automorphisms, of which only generators are kept
+    grapph::Graph triangles;
+    for ( grapph::vertex_t u = 0; u < 56; u++ ) { triangles.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < 36; u += 3 ) {
+        triangles.addEdge(u, u + 1);
+        triangles.addEdge(u + 1, u + 2);
+        triangles.addEdge(u, u + 2);
+    }
+
+    // Assertions
+    grapph::CanonicalForm form(triangles);
+    for ( unsigned seed = 1; seed <= 3; seed++ ) {
+        grapph::Graph renamed = shuffled(triangles, seed);
+        ASSERT_TRUE(form == grapph::CanonicalForm(renamed));
+    }
+
+    grapph::Graph path = shuffled(triangles, 4);
+    grapph::edge_t edge = *path.getEdges().begin();
+    path.removeEdge(edge);
+    ASSERT_FALSE(grapph::CanonicalForm::isIsomorphic(triangles, path));
+}
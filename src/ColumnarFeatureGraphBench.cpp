@@ -0,0 +1,72 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "ColumnarFeatureGraph.h"
+
+static grapph::FeatureGraph<double, double> randomFeatureGraph(size_t n, size_t degree) {
+    std::vector<std::pair<grapph::vertex_t, double>> vertices;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.push_back({ u, 1.0 }); }
+
+    std::vector<std::pair<grapph::edge_t, double>> edges;
+    for ( const grapph::edge_t & edge : randomEdgeList(n, degree) ) {
+        edges.push_back({ edge, static_cast<double>((edge.first ^ edge.second) % 97) });
+    }
+
+    return grapph::FeatureGraph<double, double>(vertices, edges);
+}
+
+static void BM_FeatureGraphEdgeSum(benchmark::State & state) {
+    grapph::FeatureGraph<double, double> graph = randomFeatureGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        double sum = 0;
+        for ( const std::pair<const grapph::edge_t, double> & pair : graph.viewEdgeWeights() ) { sum += pair.second; }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdgeWeights().size());
+}
+BENCHMARK(BM_FeatureGraphEdgeSum)->Args({1 << 16, 16});
+
+static void BM_ColumnarEdgeSum(benchmark::State & state) {
+    grapph::FeatureGraph<double, double> source = randomFeatureGraph(state.range(0), state.range(1));
+    grapph::ColumnarFeatureGraph<double, double> graph(source);
+
+    for ( auto _ : state ) {
+        double sum = 0;
+        for ( double weight : graph.viewEdgeStates() ) { sum += weight; }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * graph.getNumEdges());
+}
+BENCHMARK(BM_ColumnarEdgeSum)->Args({1 << 16, 16});
+
+static void BM_FeatureGraphIncidentWeights(benchmark::State & state) {
+    grapph::FeatureGraph<double, double> graph = randomFeatureGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        double sum = 0;
+        for ( grapph::vertex_t u : graph.viewVertices() ) {
+            for ( grapph::vertex_t w : graph.viewNeighbors(u) ) {
+                sum += graph.viewEdgeWeights().find({ std::min(u, w), std::max(u, w) })->second;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * graph.viewEdges().size());
+}
+BENCHMARK(BM_FeatureGraphIncidentWeights)->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_ColumnarIncidentWeights(benchmark::State & state) {
+    grapph::FeatureGraph<double, double> source = randomFeatureGraph(state.range(0), state.range(1));
+    grapph::ColumnarFeatureGraph<double, double> graph(source);
+
+    for ( auto _ : state ) {
+        double sum = 0;
+        for ( grapph::vertex_t u : graph.getGraph().viewVertices() ) {
+            for ( size_t id : graph.viewIncidentEdges(u) ) { sum += graph.viewEdgeStates()[id]; }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * graph.getNumEdges());
+}
+BENCHMARK(BM_ColumnarIncidentWeights)->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
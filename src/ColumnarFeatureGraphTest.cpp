@@ -0,0 +1,90 @@
+#include "gtest/gtest.h"
+
+#include "ColumnarFeatureGraph.h"
+
+#include <numeric>
+
+static grapph::FeatureGraph<std::string, long int> weightedTriangleWithTail() {
+    return grapph::FeatureGraph<std::string, long int>(
+            { {0, "a"}, {2, "b"}, {5, "c"}, {9, "d"} },
+            { {{0, 2}, 3}, {{2, 5}, 4}, {{5, 0}, 5}, {{9, 5}, 6}, {{9, 9}, 7} });
+}
+
+TEST(ColumnarFeatureGraphTest, TestColumns) {
+    grapph::FeatureGraph<std::string, long int> source = weightedTriangleWithTail();
+    grapph::ColumnarFeatureGraph<std::string, long int> columnar(source);
+
+    // Assertions
+    ASSERT_EQ(4, columnar.getNumVertices());
+    ASSERT_EQ(5, columnar.getNumEdges());
+    ASSERT_EQ("c", columnar.getVertexState(5));
+    ASSERT_EQ(5, columnar.getEdgeState({0, 5}));
+    ASSERT_EQ(5, columnar.getEdgeState({5, 0}));
+    ASSERT_EQ(7, columnar.getEdgeState({9, 9}));
+
+    std::vector<std::string> vertex_column = { "a", "b", "c", "d" };
+    std::vector<long int> edge_column = { 3, 5, 4, 6, 7 };
+    ASSERT_EQ(vertex_column, columnar.viewVertexStates());
+    ASSERT_EQ(edge_column, columnar.viewEdgeStates());
+    ASSERT_EQ(grapph::edge_t(0, 5), columnar.viewEdgeList()[1]);
+
+    ASSERT_THROW(columnar.getVertexState(1), std::invalid_argument);
+    ASSERT_THROW(columnar.getEdgeState({0, 9}), std::invalid_argument);
+    ASSERT_THROW(columnar.getEdgeState({0, 1}), std::invalid_argument);
+}
+
+TEST(ColumnarFeatureGraphTest, TestIncidentEdges) {
+    grapph::FeatureGraph<std::string, long int> source = weightedTriangleWithTail();
+    grapph::ColumnarFeatureGraph<std::string, long int> columnar(source);
+
+    // Every neighbor's edge id leads back to that edge's state
+    for ( grapph::vertex_t u : columnar.getGraph().viewVertices() ) {
+        grapph::CompactGraph::view_t neighbors = columnar.getGraph().viewNeighbors(u);
+        grapph::ColumnarFeatureGraph<std::string, long int>::id_view_t ids = columnar.viewIncidentEdges(u);
+        ASSERT_EQ(neighbors.size(), ids.size());
+
+        const grapph::vertex_t * w = neighbors.begin();
+        for ( size_t id : ids ) {
+            ASSERT_EQ(source.getEdgeState({ std::min(u, *w), std::max(u, *w) }), columnar.viewEdgeStates()[id]);
+            w++;
+        }
+    }
+}
+
+TEST(ColumnarFeatureGraphTest, TestUpdateAndThaw) {
+    grapph::FeatureGraph<std::string, long int> source = weightedTriangleWithTail();
+    grapph::ColumnarFeatureGraph<std::string, long int> columnar(source);
+
+    // Point updates and bulk transforms
+    columnar.updateVertex(9, "z");
+    columnar.updateEdge({5, 2}, 40);
+    columnar.transformEdgeStates([](long int weight) { return 2 * weight; }, 2);
+    columnar.transformVertexStates([](const std::string & state) { return state + "!"; });
+
+    // Assertions
+    ASSERT_EQ("z!", columnar.getVertexState(9));
+    ASSERT_EQ(80, columnar.getEdgeState({2, 5}));
+    ASSERT_EQ(6, columnar.getEdgeState({0, 2}));
+    ASSERT_EQ(122, std::accumulate(columnar.viewEdgeStates().begin(), columnar.viewEdgeStates().end(), 0L));
+
+    grapph::FeatureGraph<std::string, long int> thawed = columnar.thaw();
+    ASSERT_TRUE(thawed.equals(source));
+    ASSERT_EQ("a!", thawed.getVertexState(0));
+    ASSERT_EQ(14, thawed.getEdgeState({9, 9}));
+}
+
+TEST(ColumnarFeatureGraphTest, TestBoolStates) {
+    grapph::FeatureGraph<int, bool> source({ {1, 10}, {2, 20}, {3, 30} },
+                                           { {{1, 2}, true}, {{2, 3}, false}, {{1, 3}, true} });
+    grapph::ColumnarFeatureGraph<int, bool> columnar(source);
+
+    // Bools are stored one per byte, so parallel transforms are safe
+    columnar.transformEdgeStates([](bool state) { return !state; }, 2);
+    grapph::ColumnarFeatureGraph<int, bool> copy(columnar);
+
+    // Assertions
+    ASSERT_FALSE(copy.getEdgeState({2, 1}));
+    ASSERT_TRUE(copy.getEdgeState({3, 2}));
+    ASSERT_EQ(std::vector<bool>({ false, false, true }), copy.viewEdgeStates());
+    ASSERT_EQ(20, copy.getVertexState(2));
+}
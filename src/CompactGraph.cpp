@@ -0,0 +1,162 @@
+#include "CompactGraph.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    size_t CompactGraph::validate(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return position;
+    }
+
+    CompactGraph::CompactGraph(Graph & graph)
+            : index(graph.viewVertices().begin(), graph.viewVertices().end()),
+              num_edges(graph.viewEdges().size()) {
+        // Every edge appears in both endpoint rows except self loops
+        size_t total = 2 * num_edges;
+        for ( const edge_t & edge : graph.viewEdges() ) {
+            if ( edge.first == edge.second ) { total--; }
+        }
+        std::vector<vertex_t> row_data;
+        row_data.reserve(total);
+
+        // Lay rows out in vertex order
+        std::vector<size_t> row_offsets;
+        row_offsets.reserve(index.size() + 1);
+        row_offsets.push_back(0);
+        for ( vertex_t vertex : graph.viewVertices() ) {
+            const vset_t & row = graph.viewNeighbors(vertex);
+            row_data.insert(row_data.end(), row.begin(), row.end());
+            row_offsets.push_back(row_data.size());
+        }
+
+        offsets = std::move(row_offsets);
+        neighbors = std::move(row_data);
+    }
+
+    CompactGraph::CompactGraph(const std::vector<vertex_t> & vertex_list, const std::vector<edge_t> & edge_list)
+            : index(vertex_list.begin(), vertex_list.end()),
+              num_edges(edge_list.size()) {
+        // Count row lengths, then prefix-sum them into offsets
+        std::vector<size_t> row_offsets(index.size() + 1, 0);
+        for ( const edge_t & edge : edge_list ) {
+            row_offsets[index.indexOf(edge.first) + 1]++;
+            if ( edge.first != edge.second ) { row_offsets[index.indexOf(edge.second) + 1]++; }
+        }
+        for ( size_t i = 0; i < index.size(); i++ ) { row_offsets[i + 1] += row_offsets[i]; }
+
+        // Sorted edges reach each row in increasing neighbor order
+        std::vector<vertex_t> row_data(row_offsets.back());
+        std::vector<size_t> cursor(row_offsets.begin(), row_offsets.end() - 1);
+        for ( const edge_t & edge : edge_list ) {
+            size_t i = index.indexOf(edge.first);
+            row_data[cursor[i]++] = edge.second;
+            if ( edge.first != edge.second ) {
+                size_t j = index.indexOf(edge.second);
+                row_data[cursor[j]++] = edge.first;
+            }
+        }
+
+        offsets = std::move(row_offsets);
+        neighbors = std::move(row_data);
+    }
+
+    CompactGraph::CompactGraph(VertexIndex index, Buffer<size_t> offsets, Buffer<vertex_t> neighbors, size_t num_edges)
+            : index(std::move(index)), offsets(std::move(offsets)), neighbors(std::move(neighbors)),
+              num_edges(num_edges) {}
+
+    bool CompactGraph::adjacent(vertex_t first, vertex_t second) const {
+        // Validate vertices
+        size_t i = validate(first);
+        size_t j = validate(second);
+
+        // Search the shorter of the two rows
+        if ( offsets[i + 1] - offsets[i] > offsets[j + 1] - offsets[j] ) {
+            std::swap(i, j);
+            std::swap(first, second);
+        }
+
+        return std::binary_search(neighbors.data() + offsets[i],
+                                  neighbors.data() + offsets[i + 1], second);
+    }
+
+    bool CompactGraph::incident(vertex_t vertex, edge_t edge) const {
+        // Validate vertex
+        validate(vertex);
+
+        return vertex == edge.first || vertex == edge.second;
+    }
+
+    std::set<vertex_t> CompactGraph::getNeighbors(vertex_t vertex) const {
+        view_t row = viewNeighbors(vertex);
+
+        return std::set<vertex_t>(row.begin(), row.end());
+    }
+
+    size_t CompactGraph::getDegree(vertex_t vertex) const {
+        size_t i = validate(vertex);
+
+        return offsets[i + 1] - offsets[i];
+    }
+
+    std::set<vertex_t> CompactGraph::getVertices() const {
+        return std::set<vertex_t>(index.getIds().begin(), index.getIds().end());
+    }
+
+    std::set<edge_t> CompactGraph::getEdges() const {
+        // Rows and row contents are sorted, so edges come out in order
+        std::set<edge_t> edges;
+        for ( size_t i = 0; i < index.size(); i++ ) {
+            vertex_t u = index.idOf(i);
+            for ( size_t k = offsets[i]; k < offsets[i + 1]; k++ ) {
+                if ( u <= neighbors[k] ) { edges.insert(edges.end(), { u, neighbors[k] }); }
+            }
+        }
+
+        return edges;
+    }
+
+    CompactGraph::view_t CompactGraph::viewNeighbors(vertex_t vertex) const {
+        size_t i = validate(vertex);
+
+        return view_t(neighbors.data() + offsets[i], neighbors.data() + offsets[i + 1],
+                      offsets[i + 1] - offsets[i]);
+    }
+
+    CompactGraph::view_t CompactGraph::viewVertices() const {
+        const Buffer<vertex_t> & ids = index.getIds();
+
+        return view_t(ids.data(), ids.data() + ids.size(), ids.size());
+    }
+
+    size_t CompactGraph::getFirstSlot(vertex_t vertex) const {
+        return offsets[validate(vertex)];
+    }
+
+    size_t CompactGraph::slotOf(vertex_t first, vertex_t second) const {
+        size_t i = validate(first);
+        validate(second);
+
+        const vertex_t * row_begin = neighbors.data() + offsets[i];
+        const vertex_t * row_end = neighbors.data() + offsets[i + 1];
+        const vertex_t * at = std::lower_bound(row_begin, row_end, second);
+        if ( at == row_end || *at != second ) { return VertexIndex::npos; }
+
+        return at - neighbors.data();
+    }
+
+    Graph CompactGraph::thaw() const {
+        return Graph(getVertices(), getEdges());
+    }
+
+}
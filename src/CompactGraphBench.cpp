@@ -0,0 +1,84 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "CompactGraph.h"
+
+static void BM_GraphNeighborWalk(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> vertices = graph.getVertices();
+
+    for ( auto _ : state ) {
+        size_t sum = 0;
+        for ( grapph::vertex_t u : vertices ) {
+            for ( grapph::vertex_t w : graph.getNeighbors(u) ) { sum += w; }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * graph.getEdges().size());
+}
+BENCHMARK(BM_GraphNeighborWalk)->Args({1 << 12, 8})->Args({1 << 16, 16});
+
+static void BM_GraphNeighborView(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        size_t sum = 0;
+        for ( grapph::vertex_t u : graph.viewVertices() ) {
+            for ( grapph::vertex_t w : graph.viewNeighbors(u) ) { sum += w; }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * graph.viewEdges().size());
+}
+BENCHMARK(BM_GraphNeighborView)->Args({1 << 12, 8})->Args({1 << 16, 16});
+
+static void BM_CompactGraphNeighborWalk(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+
+    for ( auto _ : state ) {
+        size_t sum = 0;
+        for ( grapph::vertex_t u : frozen.viewVertices() ) {
+            for ( grapph::vertex_t w : frozen.viewNeighbors(u) ) { sum += w; }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * frozen.getNumEdges());
+}
+BENCHMARK(BM_CompactGraphNeighborWalk)->Args({1 << 12, 8})->Args({1 << 16, 16});
+
+static void BM_GraphAdjacent(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(graph.adjacent(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GraphAdjacent)->Args({1 << 12, 8})->Args({1 << 16, 16});
+
+static void BM_CompactGraphAdjacent(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(frozen.adjacent(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CompactGraphAdjacent)->Args({1 << 12, 8})->Args({1 << 16, 16});
+
+static void BM_Freeze(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        grapph::CompactGraph frozen(graph);
+        benchmark::DoNotOptimize(frozen.getNumEdges());
+    }
+    state.SetItemsProcessed(state.iterations() * graph.getEdges().size());
+}
+BENCHMARK(BM_Freeze)->Args({1 << 12, 8})->Args({1 << 16, 16});
@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+
+#include "CompactGraph.h"
+#include "SetFunctions.h"
+
+#include <algorithm>
+
+TEST(CompactGraphTest, TestFreezeK3) {
+    // Initialize graph with a gap in its vertex ids
+    std::set<grapph::vertex_t> vertices = { 0, 2, 3 };
+    std::set<grapph::edge_t> edges = { {0, 2}, {0, 3}, {2, 3} };
+    grapph::Graph k3(vertices, edges);
+
+    // Freeze graph
+    grapph::CompactGraph frozen(k3);
+    std::set<grapph::vertex_t> vertex_set = frozen.getVertices();
+    std::set<grapph::edge_t> edge_set = frozen.getEdges();
+
+    // Assertions
+    ASSERT_EQ(3, frozen.getNumVertices());
+    ASSERT_EQ(3, frozen.getNumEdges());
+    ASSERT_TRUE(grapph::setEquals(vertices, vertex_set));
+    ASSERT_TRUE(grapph::setEquals(edges, edge_set));
+
+    ASSERT_EQ(2, frozen.getDegree(0));
+    ASSERT_EQ(2, frozen.getDegree(2));
+    ASSERT_EQ(2, frozen.getDegree(3));
+
+    ASSERT_TRUE(frozen.adjacent(0, 2));
+    ASSERT_TRUE(frozen.adjacent(3, 0));
+    ASSERT_TRUE(frozen.adjacent(2, 3));
+    ASSERT_FALSE(frozen.adjacent(0, 0));
+
+    ASSERT_TRUE(frozen.incident(0, {0, 2}));
+    ASSERT_FALSE(frozen.incident(3, {0, 2}));
+
+    ASSERT_EQ(1, frozen.getNeighbors(0).count(2));
+    ASSERT_EQ(1, frozen.getNeighbors(0).count(3));
+    ASSERT_EQ(0, frozen.getNeighbors(0).count(0));
+
+    ASSERT_THROW(frozen.adjacent(0, 1), std::invalid_argument);
+    ASSERT_THROW(frozen.getDegree(4), std::invalid_argument);
+    ASSERT_THROW(frozen.getNeighbors(1), std::invalid_argument);
+}
+
+TEST(CompactGraphTest, TestFreezeMatchesGraph) {
+    // Initialize pentagon with tails
+    std::set<grapph::vertex_t> vertices = { 0, 1, 2, 3, 4, 5, 6 };
+    std::set<grapph::edge_t> edges = { {0, 1}, {1, 2}, {2, 3},
+                                       {3, 4}, {4, 0}, {3, 5}, {4, 6} };
+    grapph::Graph pentagon_with_tails(vertices, edges);
+    pentagon_with_tails.removeVertex(1);
+
+    // Freeze graph
+    grapph::CompactGraph frozen(pentagon_with_tails);
+
+    // Assertions
+    for ( grapph::vertex_t u : pentagon_with_tails.getVertices() ) {
+        std::set<grapph::vertex_t> expected = pentagon_with_tails.getNeighbors(u);
+        std::set<grapph::vertex_t> actual = frozen.getNeighbors(u);
+        ASSERT_TRUE(grapph::setEquals(expected, actual));
+        ASSERT_EQ(pentagon_with_tails.getDegree(u), frozen.getDegree(u));
+        ASSERT_EQ(expected.size(), frozen.viewNeighbors(u).size());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), frozen.viewNeighbors(u).begin()));
+        for ( grapph::vertex_t w : pentagon_with_tails.getVertices() ) {
+            ASSERT_EQ(pentagon_with_tails.adjacent(u, w), frozen.adjacent(u, w));
+        }
+    }
+    ASSERT_FALSE(frozen.getIndex().isIdentity());
+}
+
+TEST(CompactGraphTest, TestThaw) {
+    // Initialize graph with a self loop
+    grapph::Graph graph({ 0, 1, 2 }, { {0, 1}, {1, 1}, {1, 2} });
+
+    // Freeze and thaw
+    grapph::CompactGraph frozen(graph);
+    grapph::Graph thawed = frozen.thaw();
+
+    // Assertions
+    ASSERT_EQ(3, frozen.getNumEdges());
+    ASSERT_TRUE(frozen.adjacent(1, 1));
+    ASSERT_TRUE(graph.equals(thawed));
+}
+
+TEST(CompactGraphTest, TestFreezeEmpty) {
+    grapph::Graph empty;
+    grapph::CompactGraph frozen(empty);
+
+    // Assertions
+    ASSERT_EQ(0, frozen.getNumVertices());
+    ASSERT_EQ(0, frozen.getEdges().size());
+    ASSERT_THROW(frozen.getDegree(0), std::invalid_argument);
+}
+
+TEST(CompactGraphTest, TestSlots) {
+    // Initialize graph with a gap in its vertex ids
+    grapph::Graph graph({ 0, 2, 3 }, { {0, 2}, {0, 3}, {2, 3} });
+    grapph::CompactGraph frozen(graph);
+
+    // Assertions
+    ASSERT_EQ(6, frozen.getNumSlots());
+    ASSERT_EQ(2, frozen.getFirstSlot(2));
+    ASSERT_EQ(3, frozen.slotOf(2, 3));
+    ASSERT_EQ(3, frozen.viewNeighbors(2).begin()[1]);
+    ASSERT_TRUE(frozen.slotOf(0, 0) == grapph::VertexIndex::npos);
+    ASSERT_THROW(frozen.slotOf(0, 1), std::invalid_argument);
+}
@@ -0,0 +1,169 @@
+#include "Components.h"
+#include "Parallel.h"
+
+#include <atomic>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace grapph {
+
+    namespace {
+
+        // Neighbors every vertex links to before the giant component is sampled
+        const size_t NEIGHBOR_ROUNDS = 2;
+        const size_t SAMPLES = 1024;
+
+        typedef std::vector<std::atomic<size_t>> label_t;
+
+        // Hook the larger root under the smaller until both sides agree
+        void link(label_t & labels, size_t u, size_t v) {
+            size_t a = labels[u].load(std::memory_order_relaxed);
+            size_t b = labels[v].load(std::memory_order_relaxed);
+            while ( a != b ) {
+                size_t high = std::max(a, b);
+                size_t low = std::min(a, b);
+                size_t high_label = labels[high].load(std::memory_order_relaxed);
+                if ( high_label == low ) { break; }
+                if ( high_label == high
+                        && labels[high].compare_exchange_strong(high_label, low, std::memory_order_relaxed) ) {
+                    break;
+                }
+                a = labels[labels[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+                b = labels[low].load(std::memory_order_relaxed);
+            }
+        }
+
+        // Point every vertex straight at its root
+        void compress(label_t & labels, size_t threads) {
+            parallelFor(0, labels.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t v = lo; v < hi; v++ ) {
+                    size_t label = labels[v].load(std::memory_order_relaxed);
+                    while ( label != labels[label].load(std::memory_order_relaxed) ) {
+                        label = labels[label].load(std::memory_order_relaxed);
+                    }
+                    labels[v].store(label, std::memory_order_relaxed);
+                }
+            });
+        }
+
+    }
+
+    size_t Components::validate(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return position;
+    }
+
+    template <typename G>
+    void Components::compute(const G & graph, size_t threads) {
+        index = VertexIndex(graph.viewVertices().begin(), graph.viewVertices().end());
+        size_t n = index.size();
+
+        label_t links(n);
+        for ( size_t v = 0; v < n; v++ ) { links[v].store(v, std::memory_order_relaxed); }
+
+        // Rows are read in place; concurrent const reads are safe for every
+        // graph type, and ids map to positions without a copy
+        for ( size_t round = 0; round < NEIGHBOR_ROUNDS; round++ ) {
+            parallelFor(0, n, threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t v = lo; v < hi; v++ ) {
+                    const auto & row = graph.viewNeighbors(index.idOf(v));
+                    if ( round < row.size() ) { link(links, v, index.indexOf(*std::next(row.begin(), round))); }
+                }
+            });
+            compress(links, threads);
+        }
+
+        // Most common label among a sample is likely the giant component
+        size_t giant = n;
+        if ( n > 0 ) {
+            std::mt19937_64 rng(n);
+            std::uniform_int_distribution<size_t> pick(0, n - 1);
+            std::unordered_map<size_t, size_t> counts;
+            size_t best = 0;
+            for ( size_t i = 0; i < SAMPLES; i++ ) {
+                size_t label = links[pick(rng)].load(std::memory_order_relaxed);
+                size_t count = ++counts[label];
+                if ( count > best ) {
+                    best = count;
+                    giant = label;
+                }
+            }
+        }
+
+        // Rows are symmetric, so vertices in the giant component can skip
+        // the rest of theirs: any edge leaving it is seen from the far end
+        parallelFor(0, n, threads, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t v = lo; v < hi; v++ ) {
+                if ( links[v].load(std::memory_order_relaxed) == giant ) { continue; }
+
+                const auto & row = graph.viewNeighbors(index.idOf(v));
+                if ( row.size() <= NEIGHBOR_ROUNDS ) { continue; }
+                for ( auto it = std::next(row.begin(), NEIGHBOR_ROUNDS); it != row.end(); it++ ) {
+                    link(links, v, index.indexOf(*it));
+                }
+            }
+        });
+        compress(links, threads);
+
+        labels.resize(n);
+        num_components = 0;
+        for ( size_t v = 0; v < n; v++ ) {
+            labels[v] = links[v].load(std::memory_order_relaxed);
+            if ( labels[v] == v ) { num_components++; }
+        }
+    }
+
+    Components::Components(const Graph & graph, size_t threads) {
+        compute(graph, threads);
+    }
+
+    Components::Components(const CompactGraph & graph, size_t threads) {
+        compute(graph, threads);
+    }
+
+    Components::Components(const DenseGraph & graph, size_t threads) {
+        compute(graph, threads);
+    }
+
+    vertex_t Components::getComponent(vertex_t vertex) const {
+        return index.idOf(labels[validate(vertex)]);
+    }
+
+    bool Components::connected(vertex_t first, vertex_t second) const {
+        return labels[validate(first)] == labels[validate(second)];
+    }
+
+    std::vector<vertex_t> Components::getMembers(vertex_t vertex) const {
+        size_t label = labels[validate(vertex)];
+
+        // Nothing in the component sits before its smallest vertex
+        std::vector<vertex_t> members;
+        for ( size_t v = label; v < labels.size(); v++ ) {
+            if ( labels[v] == label ) { members.push_back(index.idOf(v)); }
+        }
+
+        return members;
+    }
+
+    std::vector<vertex_t> Components::getRepresentatives() const {
+        std::vector<vertex_t> representatives;
+        representatives.reserve(num_components);
+        for ( size_t v = 0; v < labels.size(); v++ ) {
+            if ( labels[v] == v ) { representatives.push_back(index.idOf(v)); }
+        }
+
+        return representatives;
+    }
+
+}
@@ -0,0 +1,47 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "Components.h"
+
+// Arg 2 is the thread count
+static void BM_Components(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+
+    for ( auto _ : state ) {
+        grapph::Components components(frozen, state.range(2));
+        benchmark::DoNotOptimize(components.getNumComponents());
+    }
+    state.SetItemsProcessed(state.iterations() * frozen.getNumEdges());
+}
+BENCHMARK(BM_Components)->ArgsProduct({ { 1 << 16, 1 << 18 }, { 2, 16 }, { 1, 4 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Connectivity queries between random pairs, searching vs the tracked index
+static void BM_GraphConnected(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    if ( state.range(2) != 0 ) { graph.trackConnectivity(); }
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(graph.connected(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GraphConnected)->ArgsProduct({ { 1 << 14 }, { 2 }, { 0, 1 } });
+
+// Edge insertions with and without the index kept up to date
+static void BM_GraphAddEdgeTracked(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        grapph::Graph graph;
+        if ( state.range(2) != 0 ) { graph.trackConnectivity(); }
+        for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u++ ) { graph.addVertex(u); }
+        for ( const grapph::edge_t & edge : edge_list ) { graph.addEdge(edge); }
+        benchmark::DoNotOptimize(graph.getNumComponents());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphAddEdgeTracked)->ArgsProduct({ { 1 << 14 }, { 8 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+
+#include "Components.h"
+
+#include <random>
+
+TEST(ComponentsTest, TestSmallGraph) {
+    // Initialize a triangle, a path with a self loop, and an isolated vertex
+    grapph::Graph graph({ 1, 2, 3, 5, 6, 7, 8 }, { {1, 2}, {2, 3}, {1, 3}, {5, 6}, {6, 7}, {7, 7} });
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::Components components(graph, threads);
+
+        // Assertions
+        ASSERT_EQ(3, components.getNumComponents());
+        ASSERT_EQ(1, components.getComponent(3));
+        ASSERT_EQ(5, components.getComponent(7));
+        ASSERT_EQ(8, components.getComponent(8));
+        ASSERT_TRUE(components.connected(5, 7));
+        ASSERT_FALSE(components.connected(3, 5));
+        ASSERT_EQ(std::vector<grapph::vertex_t>({ 5, 6, 7 }), components.getMembers(6));
+        ASSERT_EQ(std::vector<grapph::vertex_t>({ 1, 5, 8 }), components.getRepresentatives());
+        ASSERT_THROW(components.getComponent(4), std::invalid_argument);
+    }
+
+    grapph::Graph empty;
+    ASSERT_EQ(0, grapph::Components(empty).getNumComponents());
+}
+
+TEST(ComponentsTest, TestDenseGraph) {
+    // Two dense blocks joined by nothing, and an isolated vertex
+    std::set<grapph::edge_t> edges;
+    for ( grapph::vertex_t u = 0; u < 40; u++ ) {
+        for ( grapph::vertex_t w = u + 1; w < 40; w += 3 ) { edges.insert({ u, w }); }
+        for ( grapph::vertex_t w = u + 2; w < 40; w += 5 ) { edges.insert({ u + 100, w + 100 }); }
+    }
+    std::set<grapph::vertex_t> vertices = { 500 };
+    for ( grapph::vertex_t u = 0; u < 40; u++ ) { vertices.insert(u); vertices.insert(u + 100); }
+    grapph::Graph graph(vertices, edges);
+    grapph::DenseGraph dense(graph);
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::Components components(dense, threads);
+
+        // Assertions
+        ASSERT_EQ(3, components.getNumComponents());
+        ASSERT_EQ(0, components.getComponent(39));
+        ASSERT_EQ(100, components.getComponent(139));
+        ASSERT_FALSE(components.connected(0, 100));
+        ASSERT_EQ(std::vector<grapph::vertex_t>({ 0, 100, 500 }), components.getRepresentatives());
+    }
+}
+
+TEST(ComponentsTest, TestMatchesIncrementalIndex) {
+    // Sparse random graph with many small components and one large one
+    std::mt19937_64 rng(5);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 4999);
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < 5000; u++ ) { vertices.insert(u); }
+    std::set<grapph::edge_t> edges;
+    while ( edges.size() < 3000 ) {
+        grapph::vertex_t u = pick(rng);
+        grapph::vertex_t w = pick(rng);
+        edges.insert({ std::min(u, w), std::max(u, w) });
+    }
+    grapph::Graph graph(vertices, edges);
+    graph.trackConnectivity();
+    grapph::CompactGraph frozen(graph);
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::Components components(frozen, threads);
+
+        // Assertions
+        ASSERT_EQ(graph.getNumComponents(), components.getNumComponents());
+        for ( size_t i = 0; i < 2000; i++ ) {
+            grapph::vertex_t u = pick(rng);
+            grapph::vertex_t w = pick(rng);
+            ASSERT_EQ(graph.connected(u, w), components.connected(u, w));
+            ASSERT_LE(components.getComponent(u), u);
+        }
+    }
+}
@@ -0,0 +1,529 @@
+#include "ConcurrentGraph.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace grapph {
+
+    namespace {
+
+        // Epochs start at 1 so that 0 can mean "no open view"
+        std::atomic<uint64_t> global_epoch{1};
+
+        // One slot per reading thread, shared by every ConcurrentGraph. Only
+        // the owning thread writes a slot; writers read them all. Slots are
+        // reused after their thread exits and never freed.
+        struct alignas(64) ReaderRecord {
+            std::atomic<uint64_t> epoch{0};
+            std::atomic<bool> in_use{true};
+            ReaderRecord * next = nullptr;
+            // Views open on the owning thread; only the outermost announces
+            size_t depth = 0;
+        };
+
+        std::atomic<ReaderRecord*> records{nullptr};
+
+        ReaderRecord * acquireRecord() {
+            for ( ReaderRecord * record = records.load(); record != nullptr; record = record->next ) {
+                bool expected = false;
+                if ( !record->in_use.load(std::memory_order_relaxed)
+                        && record->in_use.compare_exchange_strong(expected, true) ) {
+                    return record;
+                }
+            }
+
+            ReaderRecord * record = new ReaderRecord();
+            record->next = records.load();
+            while ( !records.compare_exchange_weak(record->next, record) ) {}
+            return record;
+        }
+
+        // Claims a slot on the thread's first view and hands it back when the
+        // thread exits
+        struct ThreadRecord {
+            ReaderRecord * record = acquireRecord();
+            ~ThreadRecord() {
+                record->epoch.store(0);
+                record->in_use.store(false, std::memory_order_release);
+            }
+        };
+
+        ReaderRecord & threadRecord() {
+            thread_local ThreadRecord holder;
+            return *holder.record;
+        }
+
+        // Oldest epoch an open view may have seen anything from
+        uint64_t minActiveEpoch() {
+            uint64_t min = global_epoch.load();
+            for ( ReaderRecord * record = records.load(); record != nullptr; record = record->next ) {
+                uint64_t epoch = record->epoch.load();
+                if ( epoch != 0 && epoch < min ) { min = epoch; }
+            }
+            return min;
+        }
+
+        bool covers(size_t height, vertex_t vertex) {
+            size_t bits = height * ConcurrentGraph::FANOUT_BITS;
+            return bits >= 64 || (vertex >> bits) == 0;
+        }
+
+        size_t digit(vertex_t vertex, size_t level) {
+            return (vertex >> (level * ConcurrentGraph::FANOUT_BITS)) & (ConcurrentGraph::FANOUT - 1);
+        }
+
+        bool contains(const std::vector<vertex_t> & row, vertex_t vertex) {
+            return std::binary_search(row.begin(), row.end(), vertex);
+        }
+
+        void insert(std::vector<vertex_t> & row, vertex_t vertex) {
+            row.insert(std::lower_bound(row.begin(), row.end(), vertex), vertex);
+        }
+
+        void erase(std::vector<vertex_t> & row, vertex_t vertex) {
+            row.erase(std::lower_bound(row.begin(), row.end(), vertex));
+        }
+
+        void missingVertex(vertex_t vertex) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+    }
+
+    // The writer's working copy of a version. Nodes and blocks it allocated
+    // are its own to change in place; anything reached from the base version
+    // is copied on first change and the original queued for retirement.
+    class ConcurrentGraph::Draft {
+
+    public:
+
+        const Node * root;
+        size_t height;
+        size_t num_vertices;
+        size_t num_edges;
+
+        std::unordered_set<const Node*> fresh_nodes;
+        std::unordered_set<const Block*> fresh_blocks;
+        std::vector<Retired> unlinked;
+
+        explicit Draft(const Version & base)
+        : root(base.root), height(base.height), num_vertices(base.num_vertices), num_edges(base.num_edges) {}
+
+        Draft(const Draft&) = delete;
+
+        // Anything never published dies with the draft
+        ~Draft() {
+            for ( const Node * node : fresh_nodes ) { delete node; }
+            for ( const Block * block : fresh_blocks ) { delete block; }
+        }
+
+        bool changed() const { return !fresh_nodes.empty() || !fresh_blocks.empty() || !unlinked.empty(); }
+
+        // Hand every allocation over to the published version
+        void release() {
+            fresh_nodes.clear();
+            fresh_blocks.clear();
+            unlinked.clear();
+        }
+
+        const Block * lookup(vertex_t vertex) const { return find(root, height, vertex); }
+
+        Node * makeNode() {
+            Node * node = new Node();
+            fresh_nodes.insert(node);
+            return node;
+        }
+
+        Node * own(const Node * node) {
+            if ( node == nullptr )  return makeNode();
+            if ( fresh_nodes.count(node) != 0 )  return const_cast<Node*>(node);
+
+            Node * copy = new Node(*node);
+            fresh_nodes.insert(copy);
+            unlinked.push_back({ Retired::NODE, node, 0 });
+            return copy;
+        }
+
+        void drop(const Block * block) {
+            if ( block == nullptr )  return;
+            if ( fresh_blocks.erase(block) != 0 ) {
+                delete block;
+            } else {
+                unlinked.push_back({ Retired::BLOCK, block, 0 });
+            }
+        }
+
+        // Leaf slot of the vertex, with the path to it owned by the draft
+        const Block *& slot(vertex_t vertex) {
+            // Grow the trie until it covers the id; old ids all sit under child 0
+            while ( height == 0 || !covers(height, vertex) ) {
+                if ( root != nullptr ) {
+                    Node * top = makeNode();
+                    top->children[0] = root;
+                    root = top;
+                }
+                height++;
+            }
+
+            Node * node = own(root);
+            root = node;
+            for ( size_t level = height - 1; level > 0; level-- ) {
+                Node * child = own(node->children[digit(vertex, level)]);
+                node->children[digit(vertex, level)] = child;
+                node = child;
+            }
+            return node->blocks[digit(vertex, 0)];
+        }
+
+        Block * ownBlock(vertex_t vertex) {
+            const Block *& block = slot(vertex);
+            if ( fresh_blocks.count(block) != 0 )  return const_cast<Block*>(block);
+
+            Block * copy = new Block(*block);
+            fresh_blocks.insert(copy);
+            unlinked.push_back({ Retired::BLOCK, block, 0 });
+            block = copy;
+            return copy;
+        }
+
+        void addVertex(vertex_t vertex) {
+            Block * block = new Block();
+            fresh_blocks.insert(block);
+            slot(vertex) = block;
+            num_vertices++;
+        }
+
+        void removeVertex(vertex_t vertex) {
+            const Block *& block = slot(vertex);
+            const Block * doomed = block;
+            block = nullptr;
+
+            for ( vertex_t neighbor : doomed->neighbors ) {
+                if ( neighbor != vertex ) { erase(ownBlock(neighbor)->neighbors, vertex); }
+            }
+            num_edges -= doomed->neighbors.size();
+            num_vertices--;
+            drop(doomed);
+        }
+
+        void addEdge(edge_t edge) {
+            insert(ownBlock(edge.first)->neighbors, edge.second);
+            if ( edge.first != edge.second ) { insert(ownBlock(edge.second)->neighbors, edge.first); }
+            num_edges++;
+        }
+
+        void removeEdge(edge_t edge) {
+            erase(ownBlock(edge.first)->neighbors, edge.second);
+            if ( edge.first != edge.second ) { erase(ownBlock(edge.second)->neighbors, edge.first); }
+            num_edges--;
+        }
+
+    };
+
+    const ConcurrentGraph::Block * ConcurrentGraph::find(const Node * root, size_t height, vertex_t vertex) {
+        if ( root == nullptr || !covers(height, vertex) )  return nullptr;
+
+        const Node * node = root;
+        for ( size_t level = height - 1; level > 0; level-- ) {
+            node = node->children[digit(vertex, level)];
+            if ( node == nullptr )  return nullptr;
+        }
+        return node->blocks[digit(vertex, 0)];
+    }
+
+    void ConcurrentGraph::free(const Node * node, size_t height) {
+        if ( node == nullptr )  return;
+
+        for ( size_t i = 0; i < FANOUT; i++ ) {
+            if ( height > 1 ) {
+                free(node->children[i], height - 1);
+            } else {
+                delete node->blocks[i];
+            }
+        }
+        delete node;
+    }
+
+    void ConcurrentGraph::collect(const Node * node, size_t height, vertex_t prefix, std::vector<vertex_t> & out) {
+        if ( node == nullptr )  return;
+
+        for ( size_t i = 0; i < FANOUT; i++ ) {
+            vertex_t id = (prefix << FANOUT_BITS) | i;
+            if ( height > 1 ) {
+                collect(node->children[i], height - 1, id, out);
+            } else if ( node->blocks[i] != nullptr ) {
+                out.push_back(id);
+            }
+        }
+    }
+
+    void ConcurrentGraph::dispose(const Retired & entry) {
+        switch ( entry.kind ) {
+            case Retired::VERSION:
+                delete static_cast<const Version*>(entry.pointer);
+                break;
+            case Retired::NODE:
+                delete static_cast<const Node*>(entry.pointer);
+                break;
+            default:
+                delete static_cast<const Block*>(entry.pointer);
+        }
+    }
+
+    void ConcurrentGraph::publish(Draft & draft) {
+        const Version * old = current.load();
+
+        Version * next = new Version();
+        next->root = draft.root;
+        next->height = draft.height;
+        next->num_vertices = draft.num_vertices;
+        next->num_edges = draft.num_edges;
+        next->number = old->number + 1;
+        current.store(next);
+        latest.store(next->number);
+
+        // Views that announced this epoch or earlier may still hold the old
+        // version; views taken from now on see the new one
+        uint64_t epoch = global_epoch.fetch_add(1);
+        for ( Retired & unlinked : draft.unlinked ) {
+            unlinked.epoch = epoch;
+            retired.push_back(unlinked);
+        }
+        retired.push_back({ Retired::VERSION, old, epoch });
+        draft.release();
+
+        reclaim();
+    }
+
+    void ConcurrentGraph::reclaim() {
+        // Entries are retired in epoch order, so the reclaimable ones lead
+        uint64_t min = minActiveEpoch();
+        auto first_kept = std::find_if(retired.begin(), retired.end(),
+                                       [min](const Retired & entry) { return entry.epoch >= min; });
+        for ( auto it = retired.begin(); it != first_kept; ++it ) { dispose(*it); }
+        retired.erase(retired.begin(), first_kept);
+    }
+
+    ConcurrentGraph::ConcurrentGraph() : current(new Version()), latest(0) {}
+
+    ConcurrentGraph::ConcurrentGraph(Graph & graph) : current(new Version()), latest(0) {
+        Draft draft(*current.load());
+        for ( vertex_t vertex : graph.viewVertices() ) {
+            const vset_t & row = graph.viewNeighbors(vertex);
+            Block * block = new Block();
+            block->neighbors.assign(row.begin(), row.end());
+            draft.fresh_blocks.insert(block);
+            draft.slot(vertex) = block;
+        }
+        draft.num_vertices = graph.viewVertices().size();
+        draft.num_edges = graph.viewEdges().size();
+
+        std::lock_guard<std::mutex> lock(writer);
+        publish(draft);
+    }
+
+    ConcurrentGraph::~ConcurrentGraph() {
+        // No view may outlive the graph, so everything can go
+        for ( const Retired & entry : retired ) { dispose(entry); }
+
+        const Version * last = current.load();
+        free(last->root, last->height);
+        delete last;
+    }
+
+    size_t ConcurrentGraph::getNumRetired() {
+        std::lock_guard<std::mutex> lock(writer);
+        reclaim();
+        return retired.size();
+    }
+
+    vertex_t ConcurrentGraph::addVertex(vertex_t vertex) {
+        Batch batch(*this);
+        batch.addVertex(vertex);
+        batch.commit();
+        return vertex;
+    }
+
+    void ConcurrentGraph::removeVertex(vertex_t vertex) {
+        Batch batch(*this);
+        batch.removeVertex(vertex);
+        batch.commit();
+    }
+
+    edge_t ConcurrentGraph::addEdge(vertex_t first, vertex_t second) {
+        return addEdge({first, second});
+    }
+
+    edge_t ConcurrentGraph::addEdge(edge_t edge) {
+        Batch batch(*this);
+        edge = batch.addEdge(edge);
+        batch.commit();
+        return edge;
+    }
+
+    void ConcurrentGraph::removeEdge(edge_t edge) {
+        Batch batch(*this);
+        batch.removeEdge(edge);
+        batch.commit();
+    }
+
+    ConcurrentGraph::View::View(const ConcurrentGraph & graph) {
+        // Announce before loading the version, so a writer that retires it
+        // afterwards sees the announcement
+        ReaderRecord & record = threadRecord();
+        if ( record.depth++ == 0 ) { record.epoch.store(global_epoch.load()); }
+        version = graph.current.load();
+    }
+
+    ConcurrentGraph::View::View(View && other) noexcept : version(other.version) {
+        other.version = nullptr;
+    }
+
+    ConcurrentGraph::View::~View() {
+        if ( version == nullptr )  return;
+
+        ReaderRecord & record = threadRecord();
+        if ( --record.depth == 0 ) { record.epoch.store(0, std::memory_order_release); }
+    }
+
+    bool ConcurrentGraph::View::hasVertex(vertex_t vertex) const {
+        return find(version->root, version->height, vertex) != nullptr;
+    }
+
+    bool ConcurrentGraph::View::hasEdge(vertex_t first, vertex_t second) const {
+        const Block * block = find(version->root, version->height, first);
+        return block != nullptr && contains(block->neighbors, second);
+    }
+
+    bool ConcurrentGraph::View::adjacent(vertex_t first, vertex_t second) const {
+        const Block * block = find(version->root, version->height, first);
+        if ( block == nullptr )  missingVertex(first);
+        if ( !hasVertex(second) )  missingVertex(second);
+
+        return contains(block->neighbors, second);
+    }
+
+    ConcurrentGraph::view_t ConcurrentGraph::View::viewNeighbors(vertex_t vertex) const {
+        const Block * block = find(version->root, version->height, vertex);
+        if ( block == nullptr )  missingVertex(vertex);
+
+        const std::vector<vertex_t> & row = block->neighbors;
+        return view_t(row.data(), row.data() + row.size(), row.size());
+    }
+
+    size_t ConcurrentGraph::View::getDegree(vertex_t vertex) const {
+        return viewNeighbors(vertex).size();
+    }
+
+    std::vector<vertex_t> ConcurrentGraph::View::getVertices() const {
+        std::vector<vertex_t> vertices;
+        vertices.reserve(version->num_vertices);
+        collect(version->root, version->height, 0, vertices);
+        return vertices;
+    }
+
+    Graph ConcurrentGraph::View::toGraph() const {
+        std::vector<vertex_t> vertices = getVertices();
+        std::set<edge_t> edges;
+        for ( vertex_t vertex : vertices ) {
+            for ( vertex_t neighbor : viewNeighbors(vertex) ) {
+                if ( vertex <= neighbor ) { edges.insert(edges.end(), { vertex, neighbor }); }
+            }
+        }
+
+        return Graph(std::set<vertex_t>(vertices.begin(), vertices.end()), edges);
+    }
+
+    ConcurrentGraph::Batch::Batch(ConcurrentGraph & graph)
+            : graph(graph), lock(graph.writer), draft(new Draft(*graph.current.load())) {}
+
+    ConcurrentGraph::Batch::Batch(Batch && other) noexcept
+            : graph(other.graph), lock(std::move(other.lock)), draft(std::move(other.draft)) {}
+
+    ConcurrentGraph::Batch::~Batch() = default;
+
+    vertex_t ConcurrentGraph::Batch::addVertex(vertex_t vertex) {
+        if ( hasVertex(vertex) ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " already in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        draft->addVertex(vertex);
+        return vertex;
+    }
+
+    void ConcurrentGraph::Batch::removeVertex(vertex_t vertex) {
+        if ( !hasVertex(vertex) ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        draft->removeVertex(vertex);
+    }
+
+    edge_t ConcurrentGraph::Batch::addEdge(vertex_t first, vertex_t second) {
+        return addEdge({first, second});
+    }
+
+    edge_t ConcurrentGraph::Batch::addEdge(edge_t edge) {
+        // Order edge
+        if ( edge.first > edge.second ) {
+            edge = { edge.second, edge.first };
+        }
+
+        if ( !hasVertex(edge.first) )  missingVertex(edge.first);
+        if ( !hasVertex(edge.second) )  missingVertex(edge.second);
+        if ( hasEdge(edge) )  throw std::invalid_argument("Edge already added");
+
+        draft->addEdge(edge);
+        return edge;
+    }
+
+    void ConcurrentGraph::Batch::removeEdge(edge_t edge) {
+        // Order edge
+        if ( edge.second < edge.first ) {
+            edge = { edge.second, edge.first };
+        }
+
+        if ( !hasEdge(edge) ) {
+            std::stringstream ss;
+            ss << "Edge ("
+                << edge.first << ", " << edge.second
+                << ") not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        draft->removeEdge(edge);
+    }
+
+    bool ConcurrentGraph::Batch::hasVertex(vertex_t vertex) const {
+        return draft->lookup(vertex) != nullptr;
+    }
+
+    bool ConcurrentGraph::Batch::hasEdge(edge_t edge) const {
+        const Block * block = draft->lookup(edge.first);
+        return block != nullptr && contains(block->neighbors, edge.second);
+    }
+
+    uint64_t ConcurrentGraph::Batch::commit() {
+        if ( draft->changed() ) {
+            graph.publish(*draft);
+            draft.reset(new Draft(*graph.current.load()));
+        }
+
+        return graph.current.load()->number;
+    }
+
+}
@@ -0,0 +1,121 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "ConcurrentGraph.h"
+
+#include <atomic>
+#include <optional>
+#include <shared_mutex>
+#include <thread>
+
+// Readers query random adjacencies while one background writer toggles random
+// edges. Each benchmark thread is a reader; thread 0 sets up and tears down.
+static const size_t READ_VERTICES = 1 << 14;
+static const size_t READ_DEGREE = 16;
+static const size_t QUERIES_PER_VIEW = 16;
+
+static std::atomic<bool> writing(false);
+static std::thread writer;
+
+template <typename Toggle>
+static void startWriter(Toggle toggle) {
+    writing = true;
+    writer = std::thread([toggle]() mutable {
+        std::mt19937_64 rng(13);
+        while ( writing.load(std::memory_order_relaxed) ) {
+            toggle(rng() % READ_VERTICES, rng() % READ_VERTICES);
+        }
+    });
+}
+
+static void stopWriter() {
+    writing = false;
+    writer.join();
+}
+
+// Baseline: a plain Graph behind a reader-writer lock
+static std::optional<grapph::Graph> locked_graph;
+static std::shared_mutex graph_mutex;
+
+static void BM_SharedMutexGraphRead(benchmark::State & state) {
+    if ( state.thread_index() == 0 ) {
+        locked_graph.emplace(randomGraph(READ_VERTICES, READ_DEGREE));
+        startWriter([](grapph::vertex_t u, grapph::vertex_t w) {
+            std::unique_lock<std::shared_mutex> lock(graph_mutex);
+            if ( locked_graph->hasEdge(u, w) ) {
+                locked_graph->removeEdge({ u, w });
+            } else {
+                locked_graph->addEdge(u, w);
+            }
+        });
+    }
+    std::mt19937_64 rng(state.thread_index());
+
+    for ( auto _ : state ) {
+        std::shared_lock<std::shared_mutex> lock(graph_mutex);
+        for ( size_t i = 0; i < QUERIES_PER_VIEW; i++ ) {
+            benchmark::DoNotOptimize(locked_graph->hasEdge(rng() % READ_VERTICES, rng() % READ_VERTICES));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * QUERIES_PER_VIEW);
+
+    if ( state.thread_index() == 0 ) {
+        stopWriter();
+        locked_graph.reset();
+    }
+}
+BENCHMARK(BM_SharedMutexGraphRead)->ThreadRange(1, 8)->UseRealTime();
+
+static grapph::ConcurrentGraph * concurrent_graph;
+
+static void BM_ConcurrentGraphRead(benchmark::State & state) {
+    if ( state.thread_index() == 0 ) {
+        grapph::Graph graph = randomGraph(READ_VERTICES, READ_DEGREE);
+        concurrent_graph = new grapph::ConcurrentGraph(graph);
+        startWriter([](grapph::vertex_t u, grapph::vertex_t w) {
+            grapph::ConcurrentGraph::Batch batch = concurrent_graph->batch();
+            if ( batch.hasEdge({ std::min(u, w), std::max(u, w) }) ) {
+                batch.removeEdge({ u, w });
+            } else {
+                batch.addEdge(u, w);
+            }
+            batch.commit();
+        });
+    }
+    std::mt19937_64 rng(state.thread_index());
+
+    for ( auto _ : state ) {
+        grapph::ConcurrentGraph::View view = concurrent_graph->view();
+        for ( size_t i = 0; i < QUERIES_PER_VIEW; i++ ) {
+            benchmark::DoNotOptimize(view.hasEdge(rng() % READ_VERTICES, rng() % READ_VERTICES));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * QUERIES_PER_VIEW);
+
+    if ( state.thread_index() == 0 ) {
+        stopWriter();
+        delete concurrent_graph;
+    }
+}
+BENCHMARK(BM_ConcurrentGraphRead)->ThreadRange(1, 8)->UseRealTime();
+
+// Cost of publishing one edge update
+static void BM_ConcurrentGraphWrite(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), READ_DEGREE);
+    grapph::ConcurrentGraph concurrent(graph);
+    std::mt19937_64 rng(5);
+
+    for ( auto _ : state ) {
+        grapph::vertex_t u = rng() % state.range(0);
+        grapph::vertex_t w = rng() % state.range(0);
+        grapph::ConcurrentGraph::Batch batch = concurrent.batch();
+        if ( batch.hasEdge({ std::min(u, w), std::max(u, w) }) ) {
+            batch.removeEdge({ u, w });
+        } else {
+            batch.addEdge(u, w);
+        }
+        batch.commit();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ConcurrentGraphWrite)->Arg(1 << 10)->Arg(1 << 16);
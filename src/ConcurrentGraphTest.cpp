@@ -0,0 +1,213 @@
+#include "gtest/gtest.h"
+
+#include "ConcurrentGraph.h"
+
+#include <atomic>
+#include <random>
+#include <thread>
+
+TEST(ConcurrentGraphTest, TestMutations) {
+    grapph::ConcurrentGraph graph;
+    ASSERT_EQ(0, graph.getVersion());
+
+    graph.addVertex(1);
+    graph.addVertex(2);
+    graph.addVertex(300000);
+    graph.addEdge(2, 1);
+    graph.addEdge(1, 300000);
+    graph.addEdge(2, 2);
+
+    // Assertions
+    grapph::ConcurrentGraph::View view = graph.view();
+    ASSERT_EQ(6, view.getVersion());
+    ASSERT_EQ(3, view.getNumVertices());
+    ASSERT_EQ(3, view.getNumEdges());
+    ASSERT_TRUE(view.adjacent(1, 2));
+    ASSERT_TRUE(view.adjacent(300000, 1));
+    ASSERT_TRUE(view.hasEdge(2, 2));
+    ASSERT_FALSE(view.hasEdge(2, 300000));
+    ASSERT_FALSE(view.hasVertex(3));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 1, 2, 300000 }), view.getVertices());
+    grapph::ConcurrentGraph::view_t neighbors = view.viewNeighbors(1);
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 2, 300000 }),
+              std::vector<grapph::vertex_t>(neighbors.begin(), neighbors.end()));
+    ASSERT_EQ(2, view.getDegree(2));
+
+    ASSERT_THROW(graph.addVertex(1), std::invalid_argument);
+    ASSERT_THROW(graph.addEdge(1, 2), std::invalid_argument);
+    ASSERT_THROW(graph.addEdge(1, 4), std::invalid_argument);
+    ASSERT_THROW(graph.removeEdge({ 2, 300000 }), std::invalid_argument);
+    ASSERT_THROW(graph.removeVertex(4), std::invalid_argument);
+    ASSERT_THROW(view.adjacent(1, 4), std::invalid_argument);
+    ASSERT_THROW(view.viewNeighbors(4), std::invalid_argument);
+    // Failed writes publish nothing
+    ASSERT_EQ(6, graph.getVersion());
+}
+
+TEST(ConcurrentGraphTest, TestViewsAreIsolated) {
+    grapph::Graph base({ 1, 2, 3, 4 }, { {1, 2}, {2, 3}, {3, 4}, {1, 4} });
+    grapph::ConcurrentGraph graph(base);
+
+    grapph::ConcurrentGraph::View before = graph.view();
+    graph.removeVertex(2);
+    graph.addEdge(1, 3);
+    grapph::ConcurrentGraph::View after = graph.view();
+
+    // Assertions; the older view still sees its own version
+    grapph::Graph copy = before.toGraph();
+    ASSERT_TRUE(base.equals(copy));
+    ASSERT_TRUE(before.adjacent(1, 2));
+    ASSERT_EQ(4, before.getNumEdges());
+    ASSERT_FALSE(after.hasVertex(2));
+    ASSERT_TRUE(after.adjacent(1, 3));
+    ASSERT_EQ(2, after.getDegree(1));
+    ASSERT_EQ(3, after.getNumEdges());
+    ASSERT_EQ(before.getVersion() + 2, after.getVersion());
+}
+
+TEST(ConcurrentGraphTest, TestBatch) {
+    grapph::ConcurrentGraph graph;
+    {
+        grapph::ConcurrentGraph::Batch batch = graph.batch();
+        for ( grapph::vertex_t u = 0; u < 100; u++ ) { batch.addVertex(u); }
+        for ( grapph::vertex_t u = 1; u < 100; u++ ) { batch.addEdge(u - 1, u); }
+        batch.removeEdge({ 50, 49 });
+        ASSERT_TRUE(batch.hasEdge({ 1, 2 }));
+        ASSERT_FALSE(batch.hasEdge({ 49, 50 }));
+
+        // Nothing is visible until commit, which publishes one version
+        ASSERT_EQ(0, graph.view().getNumVertices());
+        ASSERT_EQ(1, batch.commit());
+
+        batch.addVertex(100);
+        // Dropped with the batch
+    }
+
+    // Assertions
+    grapph::ConcurrentGraph::View view = graph.view();
+    ASSERT_EQ(1, view.getVersion());
+    ASSERT_EQ(100, view.getNumVertices());
+    ASSERT_EQ(98, view.getNumEdges());
+    ASSERT_FALSE(view.hasVertex(100));
+    ASSERT_EQ(1, graph.batch().commit());
+}
+
+TEST(ConcurrentGraphTest, TestReclamation) {
+    grapph::ConcurrentGraph graph;
+    graph.addVertex(0);
+    graph.addVertex(1);
+    ASSERT_EQ(0, graph.getNumRetired());
+
+    // An open view pins what later writes unlink
+    {
+        grapph::ConcurrentGraph::View view = graph.view();
+        graph.addEdge(0, 1);
+        graph.removeEdge({ 0, 1 });
+        ASSERT_LT(0, graph.getNumRetired());
+        ASSERT_FALSE(view.hasEdge(0, 1));
+        ASSERT_EQ(2, view.getNumVertices());
+    }
+    ASSERT_EQ(0, graph.getNumRetired());
+
+    // Nested views on one thread behave like the outer one
+    {
+        grapph::ConcurrentGraph::View outer = graph.view();
+        {
+            grapph::ConcurrentGraph::View inner = graph.view();
+        }
+        graph.addEdge(0, 1);
+        ASSERT_LT(0, graph.getNumRetired());
+    }
+    ASSERT_EQ(0, graph.getNumRetired());
+}
+
+TEST(ConcurrentGraphTest, TestMatchesGraph) {
+    // Random updates applied to both; the views must always agree with Graph
+    std::mt19937_64 rng(17);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 199);
+    grapph::Graph reference;
+    grapph::ConcurrentGraph graph;
+
+    for ( size_t step = 0; step < 4000; step++ ) {
+        grapph::vertex_t u = pick(rng) * 37;
+        grapph::vertex_t w = pick(rng) * 37;
+        switch ( rng() % 4 ) {
+            case 0:
+                if ( !reference.hasVertex(u) ) { reference.addVertex(u); graph.addVertex(u); }
+                break;
+            case 1:
+                if ( reference.hasVertex(u) ) { reference.removeVertex(u); graph.removeVertex(u); }
+                break;
+            case 2:
+                if ( reference.hasVertex(u) && reference.hasVertex(w) && !reference.hasEdge(u, w) ) {
+                    reference.addEdge(u, w);
+                    graph.addEdge(u, w);
+                }
+                break;
+            default:
+                if ( reference.hasEdge(u, w) ) { reference.removeEdge({ u, w }); graph.removeEdge({ u, w }); }
+        }
+
+        if ( step % 500 == 0 ) {
+            grapph::Graph copy = graph.view().toGraph();
+            ASSERT_TRUE(reference.equals(copy));
+        }
+    }
+
+    grapph::Graph copy = graph.view().toGraph();
+    ASSERT_TRUE(reference.equals(copy));
+}
+
+TEST(ConcurrentGraphTest, TestReadersDuringWrites) {
+    // The writer keeps a ring 0..n-1 intact while toggling chords, so every
+    // view must show the whole ring and an edge count matching its rows
+    const grapph::vertex_t n = 512;
+    grapph::ConcurrentGraph graph;
+    {
+        grapph::ConcurrentGraph::Batch batch = graph.batch();
+        for ( grapph::vertex_t u = 0; u < n; u++ ) { batch.addVertex(u); }
+        for ( grapph::vertex_t u = 0; u < n; u++ ) { batch.addEdge(u, (u + 1) % n); }
+        batch.commit();
+    }
+
+    std::atomic<bool> done(false);
+    std::atomic<size_t> failures(0);
+    std::vector<std::thread> readers;
+    for ( size_t t = 0; t < 4; t++ ) {
+        readers.emplace_back([&, t]() {
+            std::mt19937_64 rng(t);
+            uint64_t last = 0;
+            while ( !done.load() ) {
+                // Asking for the version pins nothing and never goes back
+                uint64_t version = graph.getVersion();
+                if ( version < last ) { failures++; }
+                last = version;
+
+                grapph::ConcurrentGraph::View view = graph.view();
+                grapph::vertex_t u = rng() % n;
+                if ( !view.adjacent(u, (u + 1) % n) ) { failures++; }
+
+                size_t degrees = 0;
+                for ( grapph::vertex_t v = 0; v < n; v++ ) { degrees += view.getDegree(v); }
+                if ( degrees != 2 * view.getNumEdges() ) { failures++; }
+            }
+        });
+    }
+
+    std::mt19937_64 rng(99);
+    for ( size_t step = 0; step < 3000; step++ ) {
+        grapph::vertex_t u = rng() % n;
+        grapph::vertex_t w = (u + 2 + rng() % (n - 3)) % n;
+        if ( graph.view().hasEdge(u, w) ) {
+            graph.removeEdge({ u, w });
+        } else {
+            graph.addEdge(u, w);
+        }
+    }
+    done = true;
+    for ( std::thread & reader : readers ) { reader.join(); }
+
+    // Assertions
+    ASSERT_EQ(0, failures.load());
+    ASSERT_EQ(0, graph.getNumRetired());
+}
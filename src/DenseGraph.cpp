@@ -0,0 +1,254 @@
+#include "DenseGraph.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    size_t DenseGraph::validate(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return position;
+    }
+
+    Bitset DenseGraph::mask(const std::vector<vertex_t> & vertex_list) const {
+        Bitset positions(index.size());
+        for ( vertex_t vertex : vertex_list ) { positions.set(validate(vertex)); }
+
+        return positions;
+    }
+
+    DenseGraph::DenseGraph(Graph & graph)
+            : index(graph.viewVertices().begin(), graph.viewVertices().end()),
+              rows(index.size(), Bitset(index.size())),
+              num_edges(graph.viewEdges().size()) {
+        for ( const edge_t & edge : graph.viewEdges() ) {
+            size_t i = index.indexOf(edge.first);
+            size_t j = index.indexOf(edge.second);
+            rows[i].set(j);
+            rows[j].set(i);
+        }
+    }
+
+    DenseGraph::DenseGraph(const std::set<vertex_t> & vertices)
+            : index(vertices.begin(), vertices.end()),
+              rows(index.size(), Bitset(index.size())) {}
+
+    bool DenseGraph::prefersDense(size_t num_vertices, size_t num_edges) {
+        // Pairs include self loops
+        return 20 * num_edges >= num_vertices * (num_vertices + 1);
+    }
+
+    bool DenseGraph::hasEdge(vertex_t first, vertex_t second) const {
+        size_t i = index.indexOf(first);
+        size_t j = index.indexOf(second);
+        if ( i == VertexIndex::npos || j == VertexIndex::npos ) { return false; }
+
+        return rows[i].test(j);
+    }
+
+    Status DenseGraph::tryAddEdge(vertex_t first, vertex_t second) {
+        size_t i = index.indexOf(first);
+        size_t j = index.indexOf(second);
+        if ( i == VertexIndex::npos || j == VertexIndex::npos ) { return Status::VERTEX_NOT_FOUND; }
+        if ( rows[i].test(j) ) { return Status::EDGE_EXISTS; }
+
+        rows[i].set(j);
+        rows[j].set(i);
+        num_edges++;
+
+        return Status::SUCCESS;
+    }
+
+    Status DenseGraph::tryRemoveEdge(edge_t edge) {
+        size_t i = index.indexOf(edge.first);
+        size_t j = index.indexOf(edge.second);
+        if ( i == VertexIndex::npos || j == VertexIndex::npos || !rows[i].test(j) ) {
+            return Status::EDGE_NOT_FOUND;
+        }
+
+        rows[i].reset(j);
+        rows[j].reset(i);
+        num_edges--;
+
+        return Status::SUCCESS;
+    }
+
+    edge_t DenseGraph::addEdge(vertex_t first, vertex_t second) {
+        // Order edge
+        edge_t edge = { std::min(first, second), std::max(first, second) };
+
+        // Only build a message on failure
+        Status status = tryAddEdge(edge.first, edge.second);
+        if ( status == Status::VERTEX_NOT_FOUND ) {
+            validate(edge.first);
+            validate(edge.second);
+        } else if ( status == Status::EDGE_EXISTS ) {
+            throw std::invalid_argument("Edge already added");
+        }
+
+        return edge;
+    }
+
+    void DenseGraph::removeEdge(edge_t edge) {
+        // Order edge
+        if ( edge.second < edge.first ) {
+            edge = { edge.second, edge.first };
+        }
+
+        // Only build a message on failure
+        if ( tryRemoveEdge(edge) != Status::SUCCESS ) {
+            std::stringstream ss;
+            ss << "Edge ("
+                << edge.first << ", " << edge.second
+                << ") not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+    }
+
+    bool DenseGraph::adjacent(vertex_t first, vertex_t second) const {
+        // Validate vertices
+        size_t i = validate(first);
+        size_t j = validate(second);
+
+        return rows[i].test(j);
+    }
+
+    bool DenseGraph::incident(vertex_t vertex, edge_t edge) const {
+        // Validate vertex
+        validate(vertex);
+
+        return vertex == edge.first || vertex == edge.second;
+    }
+
+    std::set<vertex_t> DenseGraph::getNeighbors(vertex_t vertex) const {
+        const Bitset & row = rows[validate(vertex)];
+
+        std::set<vertex_t> neighbors;
+        for ( size_t j = row.findFirst(); j != Bitset::npos; j = row.findNext(j) ) {
+            neighbors.insert(neighbors.end(), index.idOf(j));
+        }
+
+        return neighbors;
+    }
+
+    size_t DenseGraph::getDegree(vertex_t vertex) const {
+        return rows[validate(vertex)].count();
+    }
+
+    std::set<vertex_t> DenseGraph::getVertices() const {
+        return std::set<vertex_t>(index.getIds().begin(), index.getIds().end());
+    }
+
+    std::set<edge_t> DenseGraph::getEdges() const {
+        // Scanning each row from its diagonal yields edges in order
+        std::set<edge_t> edges;
+        for ( size_t i = 0; i < rows.size(); i++ ) {
+            for ( size_t j = rows[i].findFrom(i); j != Bitset::npos; j = rows[i].findNext(j) ) {
+                edges.insert(edges.end(), { index.idOf(i), index.idOf(j) });
+            }
+        }
+
+        return edges;
+    }
+
+    DenseGraph::view_t DenseGraph::viewVertices() const {
+        const Buffer<vertex_t> & ids = index.getIds();
+
+        return view_t(ids.data(), ids.data() + ids.size(), ids.size());
+    }
+
+    DenseGraph::neighbor_view_t DenseGraph::viewNeighbors(vertex_t vertex) const {
+        return neighbor_view_t(&rows[validate(vertex)], &index);
+    }
+
+    const Bitset& DenseGraph::viewRow(vertex_t vertex) const {
+        return rows[validate(vertex)];
+    }
+
+    size_t DenseGraph::countCommonNeighbors(vertex_t first, vertex_t second) const {
+        return rows[validate(first)].intersectionCount(rows[validate(second)]);
+    }
+
+    std::set<vertex_t> DenseGraph::getCommonNeighbors(vertex_t first, vertex_t second) const {
+        Bitset common = rows[validate(first)];
+        common.intersect(rows[validate(second)]);
+
+        std::set<vertex_t> neighbors;
+        for ( size_t j = common.findFirst(); j != Bitset::npos; j = common.findNext(j) ) {
+            neighbors.insert(neighbors.end(), index.idOf(j));
+        }
+
+        return neighbors;
+    }
+
+    Bitset DenseGraph::neighborhoodUnion(const std::vector<vertex_t> & vertex_list) const {
+        Bitset result(index.size());
+        for ( vertex_t vertex : vertex_list ) { result.unite(rows[validate(vertex)]); }
+
+        return result;
+    }
+
+    Bitset DenseGraph::neighborhoodIntersection(const std::vector<vertex_t> & vertex_list) const {
+        // Every vertex is adjacent to all members of an empty list
+        Bitset result(index.size(), true);
+        for ( vertex_t vertex : vertex_list ) { result.intersect(rows[validate(vertex)]); }
+
+        return result;
+    }
+
+    void DenseGraph::connectAll(vertex_t vertex, const std::vector<vertex_t> & vertex_list) {
+        // Validate everything before changing anything
+        size_t i = validate(vertex);
+        Bitset added = mask(vertex_list);
+        added.subtract(rows[i]);
+
+        num_edges += added.count();
+        rows[i].unite(added);
+        for ( size_t j = added.findFirst(); j != Bitset::npos; j = added.findNext(j) ) { rows[j].set(i); }
+    }
+
+    void DenseGraph::isolate(vertex_t vertex) {
+        size_t i = validate(vertex);
+
+        num_edges -= rows[i].count();
+        for ( size_t j = rows[i].findFirst(); j != Bitset::npos; j = rows[i].findNext(j) ) { rows[j].reset(i); }
+        rows[i].clear();
+    }
+
+    DenseGraph DenseGraph::complement() const {
+        DenseGraph result;
+        result.index = index;
+        result.rows.reserve(rows.size());
+
+        // Flip each row word-wise, then drop the diagonal
+        Bitset all(index.size(), true);
+        for ( size_t i = 0; i < rows.size(); i++ ) {
+            Bitset row = all;
+            row.subtract(rows[i]);
+            row.reset(i);
+            result.rows.push_back(std::move(row));
+        }
+
+        // Loops are not complemented
+        size_t pairs = index.size() * (index.size() - 1) / 2;
+        size_t loops = 0;
+        for ( size_t i = 0; i < rows.size(); i++ ) { loops += rows[i].test(i); }
+        result.num_edges = pairs - (num_edges - loops);
+
+        return result;
+    }
+
+    Graph DenseGraph::thaw() const {
+        return Graph(getVertices(), getEdges());
+    }
+
+}
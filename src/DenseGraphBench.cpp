@@ -0,0 +1,76 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "CompactGraph.h"
+#include "DenseGraph.h"
+#include "SetFunctions.h"
+
+// Random graphs at a fifth of all pairs, above the dense threshold
+
+static void BM_GraphAdjacentDense(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(0) / 5);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(graph.adjacent(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GraphAdjacentDense)->Arg(1 << 10)->Arg(1 << 12);
+
+static void BM_DenseGraphAdjacent(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(0) / 5);
+    grapph::DenseGraph dense(graph);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(dense.adjacent(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DenseGraphAdjacent)->Arg(1 << 10)->Arg(1 << 12);
+
+// Common neighbor counts over random pairs: sorted row merge against popcount
+
+static void BM_CompactGraphCommonNeighbors(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(0) / 5);
+    grapph::CompactGraph frozen(graph);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        grapph::CompactGraph::view_t a = frozen.viewNeighbors(pick(rng));
+        grapph::CompactGraph::view_t b = frozen.viewNeighbors(pick(rng));
+        benchmark::DoNotOptimize(grapph::sortedIntersectionCount(a.begin(), a.size(), b.begin(), b.size()));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CompactGraphCommonNeighbors)->Arg(1 << 10)->Arg(1 << 12);
+
+static void BM_DenseGraphCommonNeighbors(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(0) / 5);
+    grapph::DenseGraph dense(graph);
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(dense.countCommonNeighbors(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DenseGraphCommonNeighbors)->Arg(1 << 10)->Arg(1 << 12);
+
+static void BM_DenseGraphDegrees(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(0) / 5);
+    grapph::DenseGraph dense(graph);
+
+    for ( auto _ : state ) {
+        size_t total = 0;
+        for ( grapph::vertex_t u : dense.viewVertices() ) { total += dense.getDegree(u); }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DenseGraphDegrees)->Arg(1 << 10)->Arg(1 << 12);
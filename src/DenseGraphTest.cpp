@@ -0,0 +1,130 @@
+#include "gtest/gtest.h"
+
+#include "DenseGraph.h"
+#include "SetFunctions.h"
+
+#include <algorithm>
+
+TEST(DenseGraphTest, TestMatchesGraph) {
+    // Initialize pentagon with tails, a self loop and a gap in its ids
+    std::set<grapph::vertex_t> vertices = { 0, 1, 2, 3, 4, 5, 6 };
+    std::set<grapph::edge_t> edges = { {0, 1}, {1, 2}, {2, 3}, {3, 3},
+                                       {3, 4}, {4, 0}, {3, 5}, {4, 6} };
+    grapph::Graph graph(vertices, edges);
+    graph.removeVertex(1);
+
+    // Convert graph
+    grapph::DenseGraph dense(graph);
+
+    // Assertions
+    ASSERT_EQ(graph.viewVertices().size(), dense.getNumVertices());
+    ASSERT_EQ(graph.viewEdges().size(), dense.getNumEdges());
+    ASSERT_TRUE(grapph::setEquals(graph.getEdges(), dense.getEdges()));
+    for ( grapph::vertex_t u : graph.getVertices() ) {
+        ASSERT_TRUE(grapph::setEquals(graph.getNeighbors(u), dense.getNeighbors(u)));
+        ASSERT_EQ(graph.getDegree(u), dense.getDegree(u));
+        for ( grapph::vertex_t w : graph.getVertices() ) {
+            ASSERT_EQ(graph.adjacent(u, w), dense.adjacent(u, w));
+        }
+    }
+    grapph::Graph thawed = dense.thaw();
+    ASSERT_TRUE(graph.equals(thawed));
+
+    ASSERT_THROW(dense.adjacent(0, 1), std::invalid_argument);
+    ASSERT_THROW(dense.getDegree(7), std::invalid_argument);
+    ASSERT_FALSE(dense.hasEdge(0, 1));
+}
+
+TEST(DenseGraphTest, TestEdgeUpdates) {
+    // Initialize edgeless graph
+    grapph::DenseGraph dense(std::set<grapph::vertex_t>({ 2, 4, 6 }));
+
+    // Add and remove edges
+    ASSERT_EQ(grapph::edge_t(2, 6), dense.addEdge(6, 2));
+    ASSERT_TRUE(dense.tryAddEdge(4, 4) == grapph::Status::SUCCESS);
+    ASSERT_TRUE(dense.tryAddEdge(2, 6) == grapph::Status::EDGE_EXISTS);
+    ASSERT_TRUE(dense.tryAddEdge(2, 3) == grapph::Status::VERTEX_NOT_FOUND);
+    ASSERT_THROW(dense.addEdge(2, 6), std::invalid_argument);
+    ASSERT_THROW(dense.addEdge(2, 3), std::invalid_argument);
+
+    // Assertions
+    ASSERT_EQ(2, dense.getNumEdges());
+    ASSERT_TRUE(dense.adjacent(6, 2));
+    ASSERT_EQ(1, dense.getDegree(4));
+
+    dense.removeEdge({ 6, 2 });
+    ASSERT_FALSE(dense.adjacent(2, 6));
+    ASSERT_EQ(1, dense.getNumEdges());
+    ASSERT_TRUE(dense.tryRemoveEdge({ 2, 6 }) == grapph::Status::EDGE_NOT_FOUND);
+    ASSERT_THROW(dense.removeEdge({ 2, 6 }), std::invalid_argument);
+}
+
+TEST(DenseGraphTest, TestNeighborhoods) {
+    // Initialize K4 minus an edge, plus a pendant vertex
+    grapph::Graph graph({ 0, 1, 2, 3, 4 }, { {0, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3}, {3, 4} });
+    grapph::DenseGraph dense(graph);
+
+    // Assertions
+    ASSERT_EQ(2, dense.countCommonNeighbors(0, 1));
+    ASSERT_EQ(std::set<grapph::vertex_t>({ 2, 3 }), dense.getCommonNeighbors(0, 1));
+    ASSERT_EQ(0, dense.countCommonNeighbors(2, 4));
+
+    grapph::Bitset any = dense.neighborhoodUnion({ 2, 4 });
+    ASSERT_EQ(3, any.count());
+    ASSERT_TRUE(any.test(0) && any.test(1) && any.test(3));
+
+    grapph::Bitset all = dense.neighborhoodIntersection({ 0, 1 });
+    ASSERT_EQ(2, all.count());
+    ASSERT_TRUE(all.test(2) && all.test(3));
+    ASSERT_EQ(5, dense.neighborhoodIntersection({}).count());
+}
+
+TEST(DenseGraphTest, TestViewNeighbors) {
+    // Sparse ids, a self loop and an isolated vertex
+    grapph::Graph graph({ 3, 70, 200, 9000 }, { {3, 200}, {70, 200}, {200, 200}, {3, 70} });
+    grapph::DenseGraph dense(graph);
+
+    // Assertions; rows read like Graph's sorted sets
+    for ( grapph::vertex_t u : graph.viewVertices() ) {
+        grapph::DenseGraph::neighbor_view_t row = dense.viewNeighbors(u);
+        const grapph::vset_t & expected = graph.viewNeighbors(u);
+        ASSERT_EQ(expected.size(), row.size());
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), row.begin(), row.end()));
+    }
+    ASSERT_TRUE(dense.viewNeighbors(9000).empty());
+    ASSERT_EQ(3, *dense.viewNeighbors(200).begin());
+    ASSERT_THROW(dense.viewNeighbors(4), std::invalid_argument);
+}
+
+TEST(DenseGraphTest, TestBulkRows) {
+    // Initialize path 0 - 1 - 2 - 3 with a loop on 3
+    grapph::Graph graph({ 0, 1, 2, 3 }, { {0, 1}, {1, 2}, {2, 3}, {3, 3} });
+    grapph::DenseGraph dense(graph);
+
+    // Connect 0 to everything, including itself and an existing neighbor
+    dense.connectAll(0, { 0, 1, 2, 3 });
+    ASSERT_EQ(7, dense.getNumEdges());
+    ASSERT_EQ(4, dense.getDegree(0));
+    ASSERT_TRUE(dense.adjacent(3, 0));
+    ASSERT_THROW(dense.connectAll(0, { 1, 9 }), std::invalid_argument);
+    ASSERT_EQ(7, dense.getNumEdges());
+
+    // Complement drops loops and flips every other pair
+    grapph::DenseGraph flipped = dense.complement();
+    ASSERT_EQ(std::set<grapph::edge_t>({ {1, 3} }), flipped.getEdges());
+    ASSERT_EQ(1, flipped.getNumEdges());
+
+    // Isolating removes the whole row and column
+    dense.isolate(3);
+    ASSERT_EQ(0, dense.getDegree(3));
+    ASSERT_EQ(4, dense.getNumEdges());
+    ASSERT_FALSE(dense.adjacent(2, 3));
+    ASSERT_EQ(std::set<grapph::edge_t>({ {0, 0}, {0, 1}, {0, 2}, {1, 2} }), dense.getEdges());
+}
+
+TEST(DenseGraphTest, TestPrefersDense) {
+    // Assertions
+    ASSERT_TRUE(grapph::DenseGraph::prefersDense(100, 600));
+    ASSERT_FALSE(grapph::DenseGraph::prefersDense(100, 400));
+    ASSERT_TRUE(grapph::DenseGraph::prefersDense(0, 0));
+}
@@ -0,0 +1,84 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "FeatureGraph.h"
+
+static grapph::FeatureGraph<double, double> randomWeightedGraph(size_t n, size_t degree,
+                                                                 std::vector<grapph::edge_t> & edge_list) {
+    std::vector<std::pair<grapph::vertex_t, double>> vertices;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.push_back({ u, 0.0 }); }
+
+    edge_list = randomEdgeList(n, degree);
+    std::vector<std::pair<grapph::edge_t, double>> edges;
+    for ( const grapph::edge_t & edge : edge_list ) { edges.push_back({ edge, 1.0 }); }
+
+    return grapph::FeatureGraph<double, double>(vertices, edges);
+}
+
+static void BM_FeatureGraphUpdateEdgeLoop(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list;
+    grapph::FeatureGraph<double, double> graph = randomWeightedGraph(state.range(0), state.range(1), edge_list);
+
+    for ( auto _ : state ) {
+        for ( const grapph::edge_t & edge : edge_list ) {
+            graph.updateEdge({ std::min(edge.first, edge.second), std::max(edge.first, edge.second) }, 2.0);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_FeatureGraphUpdateEdgeLoop)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_FeatureGraphUpdateEdges(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list;
+    grapph::FeatureGraph<double, double> graph = randomWeightedGraph(state.range(0), state.range(1), edge_list);
+    std::vector<double> weights(edge_list.size(), 2.0);
+
+    for ( auto _ : state ) {
+        graph.updateEdges(edge_list, weights, state.range(2));
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_FeatureGraphUpdateEdges)->Args({1 << 14, 16, 1})->Args({1 << 14, 16, 0})->Unit(benchmark::kMillisecond);
+
+static void BM_FeatureGraphUpdateEdgesSorted(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list;
+    grapph::FeatureGraph<double, double> graph = randomWeightedGraph(state.range(0), state.range(1), edge_list);
+    for ( grapph::edge_t & edge : edge_list ) {
+        if ( edge.first > edge.second ) { edge = { edge.second, edge.first }; }
+    }
+    std::sort(edge_list.begin(), edge_list.end());
+    std::vector<double> weights(edge_list.size(), 2.0);
+
+    for ( auto _ : state ) {
+        graph.updateEdges(edge_list, weights);
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_FeatureGraphUpdateEdgesSorted)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_FeatureGraphTransformEdgeStates(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list;
+    grapph::FeatureGraph<double, double> graph = randomWeightedGraph(state.range(0), state.range(1), edge_list);
+
+    for ( auto _ : state ) {
+        graph.transformEdgeStates([](double weight) { return weight * 0.5 + 1.0; }, state.range(2));
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_FeatureGraphTransformEdgeStates)->Args({1 << 14, 16, 1})->Args({1 << 14, 16, 0})->Unit(benchmark::kMillisecond);
+
+static void BM_FeatureGraphAutoStateInsert(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+    bool lazy = state.range(2) != 0;
+
+    for ( auto _ : state ) {
+        grapph::FeatureGraph<double, std::vector<double>> graph;
+        graph.setVertexAutoState([](grapph::vertex_t u) { return static_cast<double>(u); }, lazy);
+        graph.setEdgeAutoState([](grapph::edge_t edge) { return std::vector<double>(8, edge.first); }, lazy);
+        for ( grapph::vertex_t u = 0; u < static_cast<size_t>(state.range(0)); u++ ) { graph.addVertex(u); }
+        for ( const grapph::edge_t & edge : edge_list ) { graph.addEdge(edge); }
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_FeatureGraphAutoStateInsert)->Args({1 << 14, 16, 0})->Args({1 << 14, 16, 1})->Unit(benchmark::kMillisecond);
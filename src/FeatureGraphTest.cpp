@@ -2,6 +2,9 @@
 
 #include "FeatureGraph.h"
 
+#include <atomic>
+#include <thread>
+
 TEST(FeatureGraphTest, TestConstructor1_1) {
     // Construct empty graph
     grapph::FeatureGraph<std::string, long int> graph;
@@ -309,3 +312,308 @@ TEST(FeatureGraphTest, TestRemoveEdge_1) {
     ASSERT_EQ(1, graph.getDegree(5));
     ASSERT_EQ(1, graph.getDegree(6));
 }
+
+TEST(FeatureGraphTest, TestViews_1) {
+    // Construct trail of len 2
+    grapph::FeatureGraph<std::string, long int> graph({{0, "a"}, {1, "b"}, {2, "c"}},
+                                                      {{{0, 1}, 3}, {{1, 2}, 4}});
+
+    // Views alias internal storage
+    const grapph::FeatureGraph<std::string, long int>::vertex_states_t & vertex_states = graph.viewVertexStates();
+    const grapph::FeatureGraph<std::string, long int>::edge_states_t & edge_weights = graph.viewEdgeWeights();
+
+    // Assertions
+    ASSERT_EQ(3, vertex_states.size());
+    ASSERT_EQ("b", vertex_states.at(1));
+    ASSERT_EQ(4, edge_weights.at({1, 2}));
+
+    graph.removeVertex(1);
+    ASSERT_EQ(2, vertex_states.size());
+    ASSERT_EQ(0, edge_weights.size());
+    ASSERT_EQ(0, graph.getEdges().size());
+}
+
+TEST(FeatureGraphTest, TestTryApi_1) {
+    // Construct feature graph without auto states
+    grapph::FeatureGraph<std::string, long int> graph({{0, "n0"}, {1, "n1"}}, {});
+
+    // Without auto states only explicit states can be added
+    ASSERT_EQ(grapph::Status::NO_AUTO_STATE, graph.tryAddVertex(2));
+    ASSERT_EQ(grapph::Status::NO_AUTO_STATE, graph.tryAddEdge(0, 1));
+    ASSERT_FALSE(graph.hasEdge(0, 1));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryAddVertex(2, "n2"));
+    ASSERT_EQ(grapph::Status::VERTEX_EXISTS, graph.tryAddVertex(2, "n2"));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryAddEdge({2, 1}, 5));
+    ASSERT_EQ(grapph::Status::EDGE_EXISTS, graph.tryAddEdge({1, 2}, 6));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_FOUND, graph.tryAddEdge({1, 9}, 6));
+
+    // Lookups
+    std::string vertex_state;
+    long int edge_state = 0;
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryGetVertexState(2, vertex_state));
+    ASSERT_EQ("n2", vertex_state);
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_FOUND, graph.tryGetVertexState(9, vertex_state));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryGetEdgeState({1, 2}, edge_state));
+    ASSERT_EQ(5, edge_state);
+    ASSERT_EQ(grapph::Status::EDGE_NOT_FOUND, graph.tryGetEdgeState({0, 1}, edge_state));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryUpdateEdge({1, 2}, 8));
+    ASSERT_EQ(8, graph.getEdgeState({1, 2}));
+
+    // Removal through the base class drops state too
+    grapph::Graph & base = graph;
+    ASSERT_EQ(grapph::Status::SUCCESS, base.tryRemoveEdge({2, 1}));
+    ASSERT_EQ(0, graph.viewEdgeWeights().size());
+    ASSERT_EQ(grapph::Status::SUCCESS, base.tryRemoveVertex(2));
+    ASSERT_EQ(2, graph.viewVertexStates().size());
+}
+
+TEST(FeatureGraphTest, TestAddEdgeUnordered_1) {
+    // Construct feature graph with two vertices and default edge weight
+    grapph::FeatureGraph<std::string, long int> graph({{0, "n0"}, {1, "n1"}}, {});
+    graph.setEdgeAutoState(auto_edge_weight);
+
+    // Add edge given back to front
+    grapph::edge_t edge = graph.addEdge({1, 0});
+
+    // Assertions
+    ASSERT_EQ(0, edge.first);
+    ASSERT_EQ(7, graph.getEdgeState({0, 1}));
+    ASSERT_EQ(1, graph.viewEdgeWeights().size());
+    ASSERT_THROW(graph.addEdge(0, 1), std::invalid_argument);
+}
+
+TEST(FeatureGraphTest, TestBatchUpdateAndGather_1) {
+    // Construct path feature graph
+    std::vector<std::pair<grapph::vertex_t, std::string>> vertices;
+    std::vector<std::pair<grapph::edge_t, long int>> edges;
+    for ( grapph::vertex_t u = 0; u < 100; u++ ) { vertices.push_back({ u, "n" }); }
+    for ( grapph::vertex_t u = 1; u < 100; u++ ) { edges.push_back({ { u - 1, u }, 0 }); }
+    grapph::FeatureGraph<std::string, long int> graph(vertices, edges);
+
+    // Update every vertex and edge in one call each, edges given back to front
+    std::vector<grapph::vertex_t> vertex_ids;
+    std::vector<std::string> names;
+    std::vector<grapph::edge_t> edge_ids;
+    std::vector<long int> weights;
+    for ( grapph::vertex_t u = 0; u < 100; u++ ) { vertex_ids.push_back(u); names.push_back(std::to_string(u)); }
+    for ( grapph::vertex_t u = 1; u < 100; u++ ) { edge_ids.push_back({ u, u - 1 }); weights.push_back(u); }
+    graph.updateVertices(vertex_ids, names, 4);
+    graph.updateEdges(edge_ids, weights);
+
+    // Assertions
+    ASSERT_EQ("42", graph.getVertexState(42));
+    ASSERT_EQ(42, graph.getEdgeState({41, 42}));
+
+    std::vector<std::string> gathered_names;
+    std::vector<long int> gathered_weights;
+    graph.gatherVertexStates({ 7, 3, 7 }, gathered_names);
+    graph.gatherEdgeStates(edge_ids, gathered_weights, 4);
+    ASSERT_EQ(std::vector<std::string>({ "7", "3", "7" }), gathered_names);
+    ASSERT_EQ(weights, gathered_weights);
+}
+
+TEST(FeatureGraphTest, TestGatherBoolStates_1) {
+    std::vector<std::pair<grapph::vertex_t, bool>> vertices;
+    for ( grapph::vertex_t u = 0; u < 1000; u++ ) { vertices.push_back({ u, u % 3 == 0 }); }
+    grapph::FeatureGraph<bool, bool> graph(vertices, {});
+
+    // Neighbouring bits share a word, so a threaded gather must not tear them
+    std::vector<grapph::vertex_t> vertex_ids;
+    for ( grapph::vertex_t u = 0; u < 1000; u++ ) { vertex_ids.push_back(u); }
+    std::vector<bool> gathered;
+    graph.gatherVertexStates(vertex_ids, gathered, 4);
+
+    // Assertions
+    ASSERT_EQ(1000, gathered.size());
+    for ( grapph::vertex_t u = 0; u < 1000; u++ ) { ASSERT_EQ(u % 3 == 0, gathered[u]); }
+}
+
+TEST(FeatureGraphTest, TestBatchValidation_1) {
+    // Construct feature graph with two vertices and one edge
+    grapph::FeatureGraph<std::string, long int> graph({{0, "n0"}, {1, "n1"}}, {{{0, 1}, 3}});
+
+    // A bad key anywhere leaves every state untouched
+    ASSERT_THROW(graph.updateVertices({ 0, 5, 1 }, { "a", "b", "c" }, 2), std::invalid_argument);
+    ASSERT_THROW(graph.updateEdges({ {0, 1}, {1, 1} }, { 8, 9 }), std::invalid_argument);
+    ASSERT_THROW(graph.updateVertices({ 0, 1, 5 }, { "a", "b", "c" }), std::invalid_argument);
+    ASSERT_THROW(graph.updateVertices({ 0, 1 }, { "a" }), std::invalid_argument);
+    ASSERT_EQ("n0", graph.getVertexState(0));
+    ASSERT_EQ(3, graph.getEdgeState({0, 1}));
+
+    std::vector<long int> gathered;
+    ASSERT_THROW(graph.gatherEdgeStates({ {0, 2} }, gathered), std::invalid_argument);
+
+    // Repeated keys keep the last value
+    graph.updateVertices({ 1, 1 }, { "x", "y" });
+    ASSERT_EQ("y", graph.getVertexState(1));
+}
+
+TEST(FeatureGraphTest, TestTransformStates_1) {
+    // Construct feature graph with two vertices and one edge
+    grapph::FeatureGraph<std::string, long int> graph({{0, "n0"}, {1, "n1"}}, {{{0, 1}, 3}});
+
+    // Transform serially and across threads
+    graph.transformVertexStates([](const std::string & state) { return state + "!"; });
+    graph.transformEdgeStates([](long int weight) { return weight * 10; }, 4);
+
+    // Assertions
+    ASSERT_EQ("n0!", graph.getVertexState(0));
+    ASSERT_EQ("n1!", graph.getVertexState(1));
+    ASSERT_EQ(30, graph.getEdgeState({0, 1}));
+}
+
+TEST(FeatureGraphTest, TestCallableAutoState_1) {
+    // Capturing lambda numbering vertices as they are added
+    grapph::FeatureGraph<std::string, long int> graph;
+    size_t added = 0;
+    graph.setVertexAutoState([&added](grapph::vertex_t) { return "v" + std::to_string(added++); });
+    graph.setEdgeAutoState([](grapph::edge_t edge) { return static_cast<long int>(edge.first + edge.second); });
+
+    graph.addVertex(3);
+    graph.addVertex(1);
+    graph.addEdge(3, 1);
+
+    // Assertions
+    ASSERT_EQ(2, added);
+    ASSERT_EQ("v0", graph.getVertexState(3));
+    ASSERT_EQ("v1", graph.getVertexState(1));
+    ASSERT_EQ(4, graph.getEdgeState({1, 3}));
+
+    // Clearing the generator turns auto state off again
+    graph.setVertexAutoState(nullptr);
+    ASSERT_THROW(graph.addVertex(5), std::logic_error);
+}
+
+TEST(FeatureGraphTest, TestLazyAutoState_1) {
+    // Count generator calls
+    grapph::FeatureGraph<std::string, long int> graph;
+    size_t vertex_calls = 0;
+    size_t edge_calls = 0;
+    graph.setVertexAutoState([&vertex_calls](grapph::vertex_t u) {
+        vertex_calls++;
+        return "n" + std::to_string(u);
+    }, true);
+    graph.setEdgeAutoState([&edge_calls](grapph::edge_t edge) {
+        edge_calls++;
+        return static_cast<long int>(10 * edge.first + edge.second);
+    }, true);
+
+    // Structural inserts do not generate anything
+    for ( grapph::vertex_t u = 0; u < 5; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 1; u < 5; u++ ) { graph.addEdge(u, u - 1); }
+    ASSERT_EQ(0, vertex_calls);
+    ASSERT_EQ(0, edge_calls);
+
+    // First reads generate and memoize
+    ASSERT_EQ("n2", graph.getVertexState(2));
+    ASSERT_EQ("n2", graph.getVertexState(2));
+    ASSERT_EQ(1, vertex_calls);
+    long int weight = 0;
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryGetEdgeState({2, 3}, weight));
+    ASSERT_EQ(23, weight);
+    ASSERT_EQ(1, edge_calls);
+
+    // Overwriting a pending state never generates it
+    graph.updateVertex(4, "four");
+    graph.updateEdge({0, 1}, -1);
+    ASSERT_EQ(1, vertex_calls);
+    ASSERT_EQ(1, edge_calls);
+    ASSERT_THROW(graph.getEdgeState({0, 2}), std::invalid_argument);
+    ASSERT_THROW(graph.getEdgeState({1, 0}), std::invalid_argument);
+
+    // Views fill in everything still pending
+    ASSERT_EQ(5, graph.viewVertexStates().size());
+    ASSERT_EQ(4, graph.viewEdgeWeights().size());
+    ASSERT_EQ(4, vertex_calls);
+    ASSERT_EQ(3, edge_calls);
+    ASSERT_EQ("four", graph.getVertexState(4));
+    ASSERT_EQ(-1, graph.getEdgeState({0, 1}));
+    ASSERT_EQ(34, graph.getEdgeState({3, 4}));
+
+    // Removing a pending edge drops it without generating it
+    graph.addVertex(5);
+    graph.addEdge(4, 5);
+    graph.removeVertex(5);
+    ASSERT_EQ(4, vertex_calls);
+    ASSERT_EQ(3, edge_calls);
+}
+
+TEST(FeatureGraphTest, TestLazyBatchTouchesOnlyKeys_1) {
+    // Count generator calls over a large lazy graph
+    grapph::FeatureGraph<long int, long int> graph;
+    size_t vertex_calls = 0;
+    size_t edge_calls = 0;
+    graph.setVertexAutoState([&vertex_calls](grapph::vertex_t u) {
+        vertex_calls++;
+        return static_cast<long int>(u);
+    }, true);
+    graph.setEdgeAutoState([&edge_calls](grapph::edge_t edge) {
+        edge_calls++;
+        return static_cast<long int>(edge.first + edge.second);
+    }, true);
+    for ( grapph::vertex_t u = 0; u < 100000; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 1; u < 100000; u++ ) { graph.addEdge(u - 1, u); }
+
+    // Small batch updates overwrite without generating anything
+    graph.updateVertices({ 7, 99999 }, { -7, -1 });
+    graph.updateEdges({ {6, 5} }, { -11 });
+    ASSERT_EQ(0, vertex_calls);
+    ASSERT_EQ(0, edge_calls);
+
+    // A bad key still rejects the whole batch before anything is written
+    ASSERT_THROW(graph.updateVertices({ 8, 100000 }, { -8, 0 }), std::invalid_argument);
+    ASSERT_THROW(graph.updateEdges({ {8, 9}, {0, 2} }, { 0, 0 }), std::invalid_argument);
+
+    // Small gathers generate only the keys they read
+    std::vector<long int> states;
+    graph.gatherVertexStates({ 7, 8, 99999 }, states);
+    ASSERT_EQ(std::vector<long int>({ -7, 8, -1 }), states);
+    ASSERT_EQ(1, vertex_calls);
+    graph.gatherEdgeStates({ {5, 6}, {9, 8} }, states);
+    ASSERT_EQ(std::vector<long int>({ -11, 17 }), states);
+    ASSERT_EQ(1, edge_calls);
+}
+
+TEST(FeatureGraphTest, TestLazySwitchGenerator_1) {
+    // Pending states keep the generator they were added under
+    grapph::FeatureGraph<std::string, long int> graph;
+    graph.setVertexAutoState([](grapph::vertex_t) { return std::string("old"); }, true);
+    graph.addVertex(0);
+    graph.setVertexAutoState([](grapph::vertex_t) { return std::string("new"); }, true);
+    graph.addVertex(1);
+
+    // Assertions
+    std::vector<std::string> states;
+    graph.gatherVertexStates({ 0, 1 }, states);
+    ASSERT_EQ(std::vector<std::string>({ "old", "new" }), states);
+}
+
+TEST(FeatureGraphTest, TestLazyConcurrentReads_1) {
+    // Const reads from several threads each trigger lazy fills
+    grapph::FeatureGraph<long int, long int> graph;
+    std::atomic<size_t> generated(0);
+    graph.setVertexAutoState([&generated](grapph::vertex_t u) {
+        generated++;
+        return static_cast<long int>(u * 2);
+    }, true);
+    for ( grapph::vertex_t u = 0; u < 2000; u++ ) { graph.addVertex(u); }
+
+    const grapph::FeatureGraph<long int, long int> & view = graph;
+    std::atomic<size_t> wrong(0);
+    std::vector<std::thread> readers;
+    for ( size_t t = 0; t < 4; t++ ) {
+        readers.emplace_back([&view, &wrong, t]() {
+            for ( grapph::vertex_t u = t; u < 2000; u += 3 ) {
+                long int state = 0;
+                if ( view.tryGetVertexState(u, state) != grapph::Status::SUCCESS
+                        || state != static_cast<long int>(u * 2) ) { wrong++; }
+            }
+        });
+    }
+    for ( std::thread & reader : readers ) { reader.join(); }
+
+    // Assertions; every state was generated exactly once
+    ASSERT_EQ(0, wrong.load());
+    ASSERT_EQ(2000, view.viewVertexStates().size());
+    ASSERT_EQ(2000, generated.load());
+}
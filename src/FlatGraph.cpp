@@ -0,0 +1,279 @@
+#include "FlatGraph.h"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    void FlatGraph::validate(vertex_t vertex) const {
+        if ( vertex >= present.size() || !present[vertex] ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+    }
+
+    void FlatGraph::checkDensity(vertex_t largest, size_t count) {
+        if ( largest >= 2 * count + MAX_ID_SLACK ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << largest
+                << " too sparse for a FlatGraph of "
+                << count
+                << " vertices; use Graph for sparse ids";
+            throw std::invalid_argument(ss.str());
+        }
+    }
+
+    FlatGraph::FlatGraph(std::set<vertex_t> vertices, std::set<edge_t> edges) {
+        // Size storage once for the largest id
+        if ( !vertices.empty() ) {
+            checkDensity(*vertices.rbegin(), vertices.size());
+            reserve(*vertices.rbegin() + 1);
+        }
+
+        // Add each vertex
+        for ( vertex_t vertex : vertices ) {
+            addVertex(vertex);
+        }
+
+        // Add each edge
+        for ( edge_t edge : edges ) {
+            addEdge(edge);
+        }
+    }
+
+    FlatGraph::FlatGraph(Graph & graph) {
+        const vset_t & vertices = graph.viewVertices();
+        if ( !vertices.empty() ) {
+            checkDensity(*vertices.rbegin(), vertices.size());
+            reserve(*vertices.rbegin() + 1);
+        }
+
+        // Add each vertex, then copy its already sorted row
+        for ( vertex_t vertex : vertices ) {
+            addVertex(vertex);
+            const vset_t & row = graph.viewNeighbors(vertex);
+            vertex_neighbors[vertex].assign(row.begin(), row.end());
+        }
+        num_edges = graph.viewEdges().size();
+    }
+
+    void FlatGraph::reserve(size_t bound) {
+        if ( bound > present.size() ) {
+            present.resize(bound, false);
+            vertex_neighbors.resize(bound);
+        }
+    }
+
+    vertex_t FlatGraph::addVertex() {
+        addVertex(next_vertex);
+
+        // Return new vertex
+        return next_vertex - 1;
+    }
+
+    vertex_t FlatGraph::addVertex(vertex_t vertex) {
+        // Ensure vertex not already in vertex set
+        if ( vertex < present.size() && present[vertex] ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " already in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        // Grow storage geometrically so sequential inserts stay amortized O(1)
+        if ( vertex >= present.size() ) {
+            checkDensity(vertex, num_vertices + 1);
+            reserve(std::max(vertex + 1, 2 * present.size()));
+        }
+
+        // Add new vertex to vertex set
+        present[vertex] = true;
+        num_vertices++;
+
+        // Update next vertex, matching Graph
+        next_vertex = next_vertex > vertex ? next_vertex + 1 : vertex + 1;
+
+        return vertex;
+    }
+
+    void FlatGraph::removeVertex(vertex_t vertex) {
+        // Ensure vertex in vertex set
+        if ( vertex >= present.size() || !present[vertex] ) {
+            std::stringstream ss;
+            ss << "Vertex "
+               << vertex
+               << " not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        // Drop vertex from each neighbor's row
+        for ( vertex_t neighbor : vertex_neighbors[vertex] ) {
+            if ( neighbor != vertex ) {
+                std::vector<vertex_t> & row = vertex_neighbors[neighbor];
+                row.erase(std::lower_bound(row.begin(), row.end(), vertex));
+            }
+            num_edges -= 1;
+        }
+
+        // Release the row itself
+        std::vector<vertex_t>().swap(vertex_neighbors[vertex]);
+        present[vertex] = false;
+        num_vertices -= 1;
+
+        // If vertex is one less than next to add, then
+        // allow to be re-added
+        if ( vertex == next_vertex - 1 ) { next_vertex -= 1; }
+    }
+
+    edge_t FlatGraph::addEdge(vertex_t first, vertex_t second) {
+        return addEdge({first, second});
+    }
+
+    edge_t FlatGraph::addEdge(edge_t edge) {
+        // Order edge
+        if ( edge.first > edge.second ) {
+            edge = { edge.second, edge.first };
+        }
+
+        // Ensure vertices both in vertex set
+        validate(edge.first);
+        validate(edge.second);
+
+        // Ensure edge does not already exist
+        std::vector<vertex_t> & first_row = vertex_neighbors[edge.first];
+        auto at = std::lower_bound(first_row.begin(), first_row.end(), edge.second);
+        if ( at != first_row.end() && *at == edge.second ) {
+            throw std::invalid_argument("Edge already added");
+        }
+
+        // Add vertices to each others' rows, keeping them sorted
+        first_row.insert(at, edge.second);
+        if ( edge.first != edge.second ) {
+            std::vector<vertex_t> & second_row = vertex_neighbors[edge.second];
+            second_row.insert(std::lower_bound(second_row.begin(), second_row.end(), edge.first), edge.first);
+        }
+        num_edges++;
+
+        return edge;
+    }
+
+    void FlatGraph::removeEdge(edge_t edge) {
+        // Order edge
+        if ( edge.second < edge.first ) {
+            edge = { edge.second, edge.first };
+        }
+
+        // Ensure edge in graph
+        if ( !adjacentUnchecked(edge) ) {
+            std::stringstream ss;
+            ss << "Edge ("
+               << edge.first << ", " << edge.second
+               << ") not in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        // Remove edge vertices from each others' rows
+        std::vector<vertex_t> & first_row = vertex_neighbors[edge.first];
+        first_row.erase(std::lower_bound(first_row.begin(), first_row.end(), edge.second));
+        if ( edge.first != edge.second ) {
+            std::vector<vertex_t> & second_row = vertex_neighbors[edge.second];
+            second_row.erase(std::lower_bound(second_row.begin(), second_row.end(), edge.first));
+        }
+        num_edges -= 1;
+    }
+
+    bool FlatGraph::adjacent(vertex_t first, vertex_t second) const {
+        // Validate vertices
+        validate(first);
+        validate(second);
+
+        return adjacentUnchecked({first, second});
+    }
+
+    bool FlatGraph::adjacentUnchecked(edge_t edge) const {
+        if ( edge.first >= present.size() || !present[edge.first]
+                || edge.second >= present.size() || !present[edge.second] ) {
+            return false;
+        }
+
+        // Search the shorter row
+        const std::vector<vertex_t> & first_row = vertex_neighbors[edge.first];
+        const std::vector<vertex_t> & second_row = vertex_neighbors[edge.second];
+        if ( first_row.size() <= second_row.size() ) {
+            return std::binary_search(first_row.begin(), first_row.end(), edge.second);
+        }
+        return std::binary_search(second_row.begin(), second_row.end(), edge.first);
+    }
+
+    bool FlatGraph::incident(vertex_t vertex, edge_t edge) const {
+        // Validate vertex
+        validate(vertex);
+
+        return vertex == edge.first || vertex == edge.second;
+    }
+
+    std::set<vertex_t> FlatGraph::getNeighbors(vertex_t vertex) const {
+        // Validate vertex
+        validate(vertex);
+
+        return std::set<vertex_t>(vertex_neighbors[vertex].begin(), vertex_neighbors[vertex].end());
+    }
+
+    size_t FlatGraph::getDegree(vertex_t vertex) const {
+        // Validate vertex
+        validate(vertex);
+
+        return vertex_neighbors[vertex].size();
+    }
+
+    FlatGraph::neighbor_view_t FlatGraph::viewNeighbors(vertex_t vertex) const {
+        // Validate vertex
+        validate(vertex);
+
+        const std::vector<vertex_t> & row = vertex_neighbors[vertex];
+        return neighbor_view_t(row.begin(), row.end(), row.size());
+    }
+
+    FlatGraph::vertex_view_t FlatGraph::viewVertices() const {
+        return vertex_view_t(VertexIterator(&present, 0), VertexIterator(&present, present.size()), num_vertices);
+    }
+
+    std::set<vertex_t> FlatGraph::getVertices() const {
+        std::set<vertex_t> vertices;
+        for ( vertex_t vertex = 0; vertex < present.size(); vertex++ ) {
+            if ( present[vertex] ) { vertices.insert(vertices.end(), vertex); }
+        }
+
+        return vertices;
+    }
+
+    std::set<edge_t> FlatGraph::getEdges() const {
+        // Rows are visited in id order and are sorted, so edges come out in order
+        std::set<edge_t> edges;
+        for ( vertex_t u = 0; u < present.size(); u++ ) {
+            auto from = std::lower_bound(vertex_neighbors[u].begin(), vertex_neighbors[u].end(), u);
+            for ( auto w = from; w != vertex_neighbors[u].end(); w++ ) {
+                edges.insert(edges.end(), { u, *w });
+            }
+        }
+
+        return edges;
+    }
+
+    size_t FlatGraph::getBytesUsed() const {
+        size_t bytes = vertex_neighbors.capacity() * sizeof(std::vector<vertex_t>) + present.capacity() / 8;
+        for ( const std::vector<vertex_t> & row : vertex_neighbors ) { bytes += row.capacity() * sizeof(vertex_t); }
+        return bytes;
+    }
+
+    Graph FlatGraph::toGraph() const {
+        return Graph(getVertices(), getEdges());
+    }
+
+}
@@ -0,0 +1,36 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "FlatGraph.h"
+#include "GraphArena.h"
+
+// Memory per edge of each representation, over sizes (arg 0) and average
+// degrees (arg 1). Graph is copied into an arena, which counts every byte
+// its nodes take; FlatGraph reports what its rows hold.
+
+static void BM_GraphBytesPerEdge(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    size_t bytes = 0;
+    for ( auto _ : state ) {
+        grapph::GraphArena arena;
+        grapph::Graph copy(graph, &arena);
+        bytes = arena.getBytesAllocated();
+        benchmark::DoNotOptimize(copy.viewEdges().size());
+    }
+    state.counters["bytes_per_edge"] = double(bytes) / graph.viewEdges().size();
+}
+BENCHMARK(BM_GraphBytesPerEdge)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
+
+static void BM_FlatGraphBytesPerEdge(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    size_t bytes = 0;
+    for ( auto _ : state ) {
+        grapph::FlatGraph flat(graph);
+        bytes = flat.getBytesUsed();
+        benchmark::DoNotOptimize(flat.getNumEdges());
+    }
+    state.counters["bytes_per_edge"] = double(bytes) / graph.viewEdges().size();
+}
+BENCHMARK(BM_FlatGraphBytesPerEdge)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+
+#include "FlatGraph.h"
+#include "SetFunctions.h"
+
+TEST(FlatGraphTest, TestK3BasicSetup) {
+
+    // Initialize graph
+    grapph::FlatGraph k3;
+
+    // Add vertices
+    grapph::vertex_t v0 = k3.addVertex();
+    grapph::vertex_t v1 = k3.addVertex(2);
+    grapph::vertex_t v2 = k3.addVertex();
+
+    // Add edges
+    grapph::edge_t e_0_1 = k3.addEdge(0, 2);
+    grapph::edge_t e_0_2 = k3.addEdge(3, 0);
+    grapph::edge_t e_1_2 = k3.addEdge({2, 3});
+    std::set<grapph::edge_t> edges = { e_0_1, e_0_2, e_1_2 };
+    std::set<grapph::edge_t> edge_set = k3.getEdges();
+
+    // Assertions
+    ASSERT_EQ(0, v0);
+    ASSERT_EQ(2, v1);
+    ASSERT_EQ(3, v2);
+    ASSERT_EQ(0, e_0_2.first);
+    ASSERT_EQ(3, e_0_2.second);
+
+    ASSERT_EQ(3, k3.getNumVertices());
+    ASSERT_EQ(3, k3.getNumEdges());
+    ASSERT_TRUE(grapph::setEquals(edges, edge_set));
+
+    ASSERT_EQ(2, k3.getDegree(v0));
+    ASSERT_EQ(2, k3.getDegree(v1));
+    ASSERT_EQ(2, k3.getDegree(v2));
+
+    ASSERT_TRUE(k3.adjacent(v0, v1));
+    ASSERT_TRUE(k3.adjacent(v2, v0));
+    ASSERT_TRUE(k3.adjacent(v1, v2));
+    ASSERT_TRUE(k3.incident(v0, e_0_1));
+    ASSERT_FALSE(k3.incident(v2, e_0_1));
+
+    ASSERT_EQ(1, k3.getNeighbors(v0).count(v1));
+    ASSERT_EQ(0, k3.getNeighbors(v0).count(v0));
+
+    ASSERT_THROW(k3.addVertex(2), std::invalid_argument);
+    ASSERT_THROW(k3.addEdge(v0, v1), std::invalid_argument);
+    ASSERT_THROW(k3.addEdge(v0, 4), std::invalid_argument);
+    ASSERT_THROW(k3.adjacent(v0, 1), std::invalid_argument);
+    ASSERT_THROW(k3.getDegree(4), std::invalid_argument);
+    ASSERT_THROW(k3.getNeighbors(1), std::invalid_argument);
+
+}
+
+TEST(FlatGraphTest, TestRemoveVertex) {
+    // Initialize graph
+    std::set<grapph::vertex_t> vertices = { 0, 1, 2, 3, 4, 5, 6 };
+    std::set<grapph::edge_t> edges = { {0, 1}, {1, 2}, {2, 3},
+                                       {3, 4}, {4, 0}, {3, 5}, {4, 6} };
+    grapph::FlatGraph pentagon_with_tails(vertices, edges);
+
+    // Remove vertex neighboring tail
+    pentagon_with_tails.removeVertex(3);
+
+    // Assertions
+    ASSERT_EQ(6, pentagon_with_tails.getVertices().size());
+    ASSERT_EQ(4, pentagon_with_tails.getEdges().size());
+    ASSERT_EQ(1, pentagon_with_tails.getDegree(2));
+    ASSERT_THROW(pentagon_with_tails.getDegree(3), std::invalid_argument);
+    ASSERT_THROW(pentagon_with_tails.removeVertex(3), std::invalid_argument);
+    ASSERT_EQ(0, pentagon_with_tails.getDegree(5));
+    ASSERT_EQ(7, pentagon_with_tails.addVertex());
+
+    // Removing the last vertex lets it be re-added
+    pentagon_with_tails.removeVertex(7);
+    ASSERT_EQ(7, pentagon_with_tails.addVertex());
+}
+
+TEST(FlatGraphTest, TestRemoveEdge) {
+    // Initialize graph with a self loop
+    grapph::FlatGraph graph({ 0, 1, 2 }, { {0, 1}, {1, 1}, {1, 2} });
+
+    // Remove edges
+    graph.removeEdge({2, 1});
+    ASSERT_THROW(graph.removeEdge({1, 2}), std::invalid_argument);
+    ASSERT_EQ(2, graph.getNumEdges());
+    ASSERT_TRUE(graph.adjacent(1, 1));
+
+    // Removing a looped vertex drops the loop once
+    graph.removeVertex(1);
+    ASSERT_EQ(0, graph.getNumEdges());
+    ASSERT_EQ(0, graph.getDegree(0));
+}
+
+TEST(FlatGraphTest, TestRejectsSparseIds) {
+    grapph::FlatGraph graph;
+    graph.addVertex(0);
+    const grapph::vertex_t limit = 2 * 2 + grapph::FlatGraph::MAX_ID_SLACK;
+
+    // Assertions; storage only ever spans dense ids
+    ASSERT_THROW(graph.addVertex(limit), std::invalid_argument);
+    ASSERT_EQ(1, graph.getNumVertices());
+    ASSERT_EQ(limit - 1, graph.addVertex(limit - 1));
+    ASSERT_GT(2 * limit * sizeof(std::vector<grapph::vertex_t>), graph.getBytesUsed());
+
+    grapph::Graph sparse({ 1, 1000000000 }, {});
+    ASSERT_THROW(grapph::FlatGraph copy(sparse), std::invalid_argument);
+    ASSERT_THROW(grapph::FlatGraph({ 0, 1000000000 }, {}), std::invalid_argument);
+}
+
+TEST(FlatGraphTest, TestMatchesGraph) {
+    // Initialize graph with sparse ids
+    std::set<grapph::vertex_t> vertices = { 1, 4, 9, 16, 25 };
+    std::set<grapph::edge_t> edges = { {1, 4}, {4, 9}, {9, 16}, {16, 25}, {25, 1}, {4, 16} };
+    grapph::Graph graph(vertices, edges);
+    grapph::FlatGraph flat(graph);
+
+    // Assertions
+    std::set<grapph::vertex_t> flat_vertices = flat.getVertices();
+    std::set<grapph::edge_t> flat_edges = flat.getEdges();
+    ASSERT_TRUE(grapph::setEquals(vertices, flat_vertices));
+    std::set<grapph::edge_t> graph_edges = graph.getEdges();
+    ASSERT_TRUE(grapph::setEquals(graph_edges, flat_edges));
+    for ( grapph::vertex_t u : vertices ) {
+        std::set<grapph::vertex_t> expected = graph.getNeighbors(u);
+        std::set<grapph::vertex_t> actual = flat.getNeighbors(u);
+        ASSERT_TRUE(grapph::setEquals(expected, actual));
+    }
+    grapph::Graph round_trip = flat.toGraph();
+    ASSERT_TRUE(graph.equals(round_trip));
+}
+
+TEST(FlatGraphTest, TestViews) {
+    // Initialize graph with sparse ids
+    grapph::FlatGraph graph({ 1, 4, 9 }, { {1, 9}, {4, 9}, {9, 9} });
+
+    // Collect views
+    std::vector<grapph::vertex_t> vertices(graph.viewVertices().begin(), graph.viewVertices().end());
+    std::vector<grapph::vertex_t> neighbors(graph.viewNeighbors(9).begin(), graph.viewNeighbors(9).end());
+
+    // Assertions
+    ASSERT_EQ(3, graph.viewVertices().size());
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 1, 4, 9 }), vertices);
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 1, 4, 9 }), neighbors);
+    ASSERT_TRUE(graph.viewNeighbors(1).size() == 1);
+    ASSERT_THROW(graph.viewNeighbors(2), std::invalid_argument);
+}
@@ -1,6 +1,10 @@
 #include "Graph.h"
+#include "Instrumentation.h"
+#include "Parallel.h"
 #include "SetFunctions.h"
+#include "VertexIndex.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -8,8 +12,106 @@
 
 namespace grapph {
 
-    void Graph::validate(vertex_t vertex) {
+    ConnectivityIndex::ConnectivityIndex(std::pmr::memory_resource * resource)
+            : nodes(resource), parents(resource), sizes(resource) {}
+
+    ConnectivityIndex::ConnectivityIndex(const ConnectivityIndex & other, std::pmr::memory_resource * resource)
+            : nodes(other.nodes, resource), parents(other.parents, resource), sizes(other.sizes, resource),
+              num_components(other.num_components) {}
+
+    size_t ConnectivityIndex::find(size_t x) const {
+        while ( parents[x] != x ) {
+            parents[x] = parents[parents[x]];
+            x = parents[x];
+        }
+
+        return x;
+    }
+
+    size_t ConnectivityIndex::node(vertex_t vertex) const {
+        return nodes.find(vertex)->second;
+    }
+
+    void ConnectivityIndex::compact() {
+        // Renumber the live vertices; the first vertex seen in each old set
+        // becomes the root of its new one
+        std::unordered_map<size_t, size_t> roots;
+        std::pmr::vector<size_t> fresh_parents(parents.get_allocator());
+        std::pmr::vector<size_t> fresh_sizes(sizes.get_allocator());
+        fresh_parents.reserve(nodes.size());
+        fresh_sizes.reserve(nodes.size());
+        for ( std::pair<const vertex_t, size_t> & pair : nodes ) {
+            size_t id = fresh_parents.size();
+            size_t root = roots.emplace(find(pair.second), id).first->second;
+            fresh_parents.push_back(root);
+            fresh_sizes.push_back(0);
+            fresh_sizes[root]++;
+            pair.second = id;
+        }
+
+        parents.swap(fresh_parents);
+        sizes.swap(fresh_sizes);
+    }
+
+    void ConnectivityIndex::clear() {
+        nodes.clear();
+        parents.clear();
+        sizes.clear();
+        num_components = 0;
+    }
+
+    void ConnectivityIndex::addVertex(vertex_t vertex) {
+        nodes[vertex] = parents.size();
+        parents.push_back(parents.size());
+        sizes.push_back(1);
+        num_components++;
+    }
+
+    void ConnectivityIndex::removeVertex(vertex_t vertex) {
+        // Its node may still link other nodes, so it stays until compacted
+        nodes.erase(vertex);
+        num_components--;
+        if ( parents.size() > 2 * nodes.size() + 64 ) { compact(); }
+    }
+
+    bool ConnectivityIndex::unite(vertex_t first, vertex_t second) {
+        size_t a = find(node(first));
+        size_t b = find(node(second));
+        if ( a == b ) { return false; }
+
+        // Hang the smaller set under the larger
+        if ( sizes[a] < sizes[b] ) { std::swap(a, b); }
+        parents[b] = a;
+        sizes[a] += sizes[b];
+        num_components--;
+
+        return true;
+    }
+
+    void ConnectivityIndex::split(const std::vector<vertex_t> & piece) {
+        if ( piece.empty() ) { return; }
+
+        sizes[find(node(piece.front()))] -= piece.size();
+
+        size_t root = parents.size();
+        for ( vertex_t vertex : piece ) {
+            nodes[vertex] = parents.size();
+            parents.push_back(root);
+            sizes.push_back(0);
+        }
+        sizes[root] = piece.size();
+        num_components++;
+
+        if ( parents.size() > 2 * nodes.size() + 64 ) { compact(); }
+    }
+
+    bool ConnectivityIndex::connected(vertex_t first, vertex_t second) const {
+        return find(node(first)) == find(node(second));
+    }
+
+    void Graph::validate(vertex_t vertex) const {
         if ( vertices.count(vertex) == 0 ) {
+            GRAPPH_INSTRUMENT_VALIDATION_FAILURE();
             std::stringstream ss;
             ss  << "Vertex "
                 << vertex
@@ -18,76 +120,199 @@ namespace grapph {
         }
     }
 
-    Graph::Graph(std::set<vertex_t> vertices, std::set<edge_t> edges) {
-        // Add each vertex
-        for ( vertex_t vertex : vertices ) {
-            addVertex(vertex);
+    uint64_t Graph::hashVertex(vertex_t vertex) {
+        // splitmix64 finalizer; vertices and edges start from different seeds
+        uint64_t z = vertex + 0x9e3779b97f4a7c15ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    uint64_t Graph::hashEdge(edge_t edge) {
+        uint64_t z = hashVertex(edge.first) * 0xff51afd7ed558ccdULL + edge.second + 0xc4ceb9fe1a85ec53ULL;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    void Graph::assign(const std::vector<vertex_t> & vertex_list, const std::vector<edge_t> & edge_list) {
+        // Sorted input means every insert below lands at the end of its
+        // container, so the hinted inserts are amortized O(1)
+        std::vector<vset_t*> rows;
+        rows.reserve(vertex_list.size());
+        for ( vertex_t vertex : vertex_list ) {
+            vertices.insert(vertices.end(), vertex);
+            fingerprint += hashVertex(vertex);
+            rows.push_back(&vertex_neighbors.emplace_hint(vertex_neighbors.end(), vertex, vset_t())->second);
         }
 
-        // Add each edge
-        for ( edge_t edge : edges ) {
-            addEdge(edge);
+        // Rows receive lower neighbors first, then higher ones, so appends stay sorted
+        VertexIndex index(vertex_list.begin(), vertex_list.end());
+        for ( const edge_t & edge : edge_list ) {
+            edges.insert(edges.end(), edge);
+            fingerprint += hashEdge(edge);
+
+            vset_t & first_row = *rows[index.indexOf(edge.first)];
+            first_row.insert(first_row.end(), edge.second);
+            if ( edge.first != edge.second ) {
+                vset_t & second_row = *rows[index.indexOf(edge.second)];
+                second_row.insert(second_row.end(), edge.first);
+            }
         }
+
+        num_vertices = vertices.size();
+        num_edges = edges.size();
+        if ( !vertex_list.empty() && vertex_list.back() >= next_vertex ) { next_vertex = vertex_list.back() + 1; }
+
+        if ( track_connectivity ) { trackConnectivity(); }
     }
 
-    vertex_t Graph::addVertex() {
-        addVertex(next_vertex);
+    std::vector<std::string> Graph::checkVertexList(const std::vector<vertex_t> & vertex_list, size_t threads) {
+        std::vector<std::vector<std::string>> found(resolveThreads(threads));
+        parallelFor(0, vertex_list.size(), threads, [&](size_t lo, size_t hi, size_t worker) {
+            for ( size_t i = std::max<size_t>(lo, 1); i < hi; i++ ) {
+                if ( vertex_list[i] == vertex_list[i - 1] ) {
+                    std::stringstream ss;
+                    ss << "Vertex " << vertex_list[i] << " already in graph";
+                    found[worker].push_back(ss.str());
+                }
+            }
+        });
 
-        // Return new vertex
-        return next_vertex - 1;
+        // Keep input order regardless of thread count
+        std::vector<std::string> problems;
+        for ( std::vector<std::string> & chunk : found ) {
+            problems.insert(problems.end(), chunk.begin(), chunk.end());
+        }
+        return problems;
     }
 
-    vertex_t Graph::addVertex(grapph::vertex_t vertex) {
-        // Ensure vertex not already in vertex set
-        bool fail = true;
-        try {
-            validate(vertex);
-        } catch (std::invalid_argument &iae) {
-            fail = false;
+    std::vector<std::string> Graph::checkEdgeList(const std::vector<vertex_t> & vertex_list,
+                                                  const std::vector<edge_t> & edge_list, size_t threads) {
+        std::vector<std::vector<std::string>> found(resolveThreads(threads));
+        parallelFor(0, edge_list.size(), threads, [&](size_t lo, size_t hi, size_t worker) {
+            for ( size_t i = lo; i < hi; i++ ) {
+                const edge_t & edge = edge_list[i];
+                std::stringstream ss;
+                if ( !std::binary_search(vertex_list.begin(), vertex_list.end(), edge.first) ) {
+                    ss << "Edge (" << edge.first << ", " << edge.second << "): vertex "
+                       << edge.first << " not found in graph";
+                } else if ( !std::binary_search(vertex_list.begin(), vertex_list.end(), edge.second) ) {
+                    ss << "Edge (" << edge.first << ", " << edge.second << "): vertex "
+                       << edge.second << " not found in graph";
+                } else if ( i > 0 && edge_list[i - 1] == edge ) {
+                    ss << "Edge (" << edge.first << ", " << edge.second << ") already added";
+                } else {
+                    continue;
+                }
+                found[worker].push_back(ss.str());
+            }
+        });
+
+        // Keep input order regardless of thread count
+        std::vector<std::string> problems;
+        for ( std::vector<std::string> & chunk : found ) {
+            problems.insert(problems.end(), chunk.begin(), chunk.end());
         }
-        if (fail) {
-            std::stringstream ss;
-            ss  << "Vertex "
-                << vertex
-                << " already in graph";
-            throw std::invalid_argument(ss.str().c_str());
+        return problems;
+    }
+
+    void Graph::throwIfInvalid(const std::vector<std::string> & problems) {
+        if ( problems.empty() ) { return; }
+        if ( problems.size() == 1 ) { throw std::invalid_argument(problems.front()); }
+
+        // Summarize rather than build an unbounded message
+        std::stringstream ss;
+        ss << problems.size() << " problems in graph input: ";
+        for ( size_t i = 0; i < problems.size() && i < 8; i++ ) {
+            ss << (i == 0 ? "" : "; ") << problems[i];
+        }
+        if ( problems.size() > 8 ) { ss << "; ..."; }
+        throw std::invalid_argument(ss.str());
+    }
+
+    Graph::Graph(std::pmr::memory_resource * resource)
+            : vertices(resource), edges(resource), vertex_neighbors(resource), connectivity(resource) {}
+
+    Graph::Graph(const Graph & other, std::pmr::memory_resource * resource)
+            : vertices(other.vertices, resource), edges(other.edges, resource),
+              vertex_neighbors(other.vertex_neighbors, resource),
+              track_connectivity(other.track_connectivity), connectivity(other.connectivity, resource),
+              num_vertices(other.num_vertices), num_edges(other.num_edges),
+              next_vertex(other.next_vertex), fingerprint(other.fingerprint) {}
+
+    Graph::Graph(std::set<vertex_t> vertices, std::set<edge_t> edges, std::pmr::memory_resource * resource)
+            : Graph(resource) {
+        // Order each edge, then sort so duplicates sit next to each other
+        std::vector<vertex_t> vertex_list(vertices.begin(), vertices.end());
+        std::vector<edge_t> edge_list;
+        edge_list.reserve(edges.size());
+        for ( edge_t edge : edges ) {
+            if ( edge.first > edge.second ) { edge = { edge.second, edge.first }; }
+            edge_list.push_back(edge);
         }
+        std::sort(edge_list.begin(), edge_list.end());
+
+        // Fill adjacency in one pass once the whole input checks out
+        throwIfInvalid(checkEdgeList(vertex_list, edge_list));
+        assign(vertex_list, edge_list);
+    }
+
+    bool Graph::hasVertex(vertex_t vertex) const {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::HAS_VERTEX);
+
+        return vertices.count(vertex) != 0;
+    }
+
+    bool Graph::hasEdge(vertex_t first, vertex_t second) const {
+        return hasEdge({first, second});
+    }
+
+    bool Graph::hasEdge(edge_t edge) const {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::HAS_EDGE);
+
+        // Order edge
+        if ( edge.first > edge.second ) {
+            edge = { edge.second, edge.first };
+        }
+
+        return edges.count(edge) != 0;
+    }
+
+    Status Graph::tryAddVertex(vertex_t vertex) {
+        // Ensure vertex not already in vertex set
+        if ( vertices.count(vertex) != 0 ) { return Status::VERTEX_EXISTS; }
 
         // Add new vertex to vertex set
         vertices.insert(vertex);
         num_vertices++;
+        fingerprint += hashVertex(vertex);
 
         // Update next vertex
         next_vertex = next_vertex > vertex ? next_vertex + 1 : vertex + 1;
 
         // Initialize list of neighbors
-        vertex_neighbors[vertex] = std::set<vertex_t>();
+        vertex_neighbors[vertex] = vset_t();
 
-        // Return new vertex
-        return vertex;
+        if ( track_connectivity ) { connectivity.addVertex(vertex); }
+
+        return Status::SUCCESS;
     }
 
-    void Graph::removeVertex(grapph::vertex_t vertex) {
+    Status Graph::tryRemoveVertex(vertex_t vertex) {
         // Ensure vertex in vertex set
-        bool fail = true;
-        try {
-            validate(vertex);
-            fail = false;
-        } catch (std::invalid_argument & iae) {
-            // Do nothing
-        }
-        if (fail) {
-            std::stringstream ss;
-            ss << "Vertex "
-                << vertex
-                << " not in graph";
-            throw std::invalid_argument(ss.str().c_str());
-        }
+        auto row = vertex_neighbors.find(vertex);
+        if ( row == vertex_neighbors.end() ) { return Status::VERTEX_NOT_FOUND; }
 
         // For each neighbor of the removed vertex,
         // update neighbors list and remove edge
-        for ( vertex_t neighbor : getNeighbors(vertex) ) {
-            vertex_neighbors[neighbor].erase(vertex);
+        std::vector<vertex_t> former;
+        for ( vertex_t neighbor : row->second ) {
+            // A self loop lives in the row being dropped below
+            if ( neighbor != vertex ) {
+                vertex_neighbors[neighbor].erase(vertex);
+                former.push_back(neighbor);
+            }
 
             edge_t edge = { vertex, neighbor };
             if ( neighbor < vertex ) {
@@ -95,76 +320,167 @@ namespace grapph {
             }
             edges.erase(edge);
             num_edges -= 1;
+            fingerprint -= hashEdge(edge);
+        }
+
+        // With every edge gone, one search from the former neighbors finds
+        // the pieces the vertex held together
+        if ( track_connectivity ) {
+            if ( !former.empty() ) { connectivity.split({ vertex }); }
+            connectivity.removeVertex(vertex);
+            separate(former);
         }
 
         // Remove vertex from vertex set
         vertices.erase(vertex);
         num_vertices -= 1;
+        fingerprint -= hashVertex(vertex);
 
         // Remove vertex from neighbors matrix
-        vertex_neighbors.erase(vertex);
+        vertex_neighbors.erase(row);
 
         // If vertex is one less than next to add, then
         // allow to be re-added
         if ( vertex == next_vertex - 1 ) { next_vertex -= 1; }
+
+        return Status::SUCCESS;
     }
 
-    edge_t Graph::addEdge(vertex_t first, vertex_t second) {
-        return addEdge({first, second});
+    Status Graph::tryAddEdge(vertex_t first, vertex_t second) {
+        return tryAddEdge({first, second});
     }
 
-    edge_t Graph::addEdge(edge_t edge) {
+    Status Graph::tryAddEdge(edge_t edge) {
         // Order edge
         if ( edge.first > edge.second ) {
             edge = { edge.second, edge.first };
         }
 
         // Ensure vertices both in vertex set
-        validate(edge.first);
-        validate(edge.second);
-
-        // Ensure edge does not already exist
-        if ( vertex_neighbors[edge.first].count(edge.second) != 0
-                || vertex_neighbors[edge.second].count(edge.first) != 0 ) {
-            throw std::invalid_argument("Edge already added");
+        auto first_row = vertex_neighbors.find(edge.first);
+        auto second_row = vertex_neighbors.find(edge.second);
+        if ( first_row == vertex_neighbors.end() || second_row == vertex_neighbors.end() ) {
+            return Status::VERTEX_NOT_FOUND;
         }
 
-        // Add edge to edge set
-        edges.insert(edge);
+        // Add edge to edge set, unless it already exists
+        if ( !edges.insert(edge).second ) { return Status::EDGE_EXISTS; }
         num_edges++;
+        fingerprint += hashEdge(edge);
 
         // Add vertices to each others' incidence lists
-        vertex_neighbors[edge.first].insert(edge.second);
-        vertex_neighbors[edge.second].insert(edge.first);
+        first_row->second.insert(edge.second);
+        second_row->second.insert(edge.first);
+
+        if ( track_connectivity ) { connectivity.unite(edge.first, edge.second); }
+
+        return Status::SUCCESS;
+    }
+
+    Status Graph::tryRemoveEdge(edge_t edge) {
+        // Order edge
+        if ( edge.second < edge.first ) {
+            edge = { edge.second, edge.first };
+        }
+
+        // Remove edge from graph, if it is there
+        if ( edges.erase(edge) == 0 ) { return Status::EDGE_NOT_FOUND; }
+        num_edges -= 1;
+        fingerprint -= hashEdge(edge);
+
+        // Remove edge vertices from each others' adjacencies
+        vertex_neighbors[edge.first].erase(edge.second);
+        vertex_neighbors[edge.second].erase(edge.first);
+
+        // The component splits exactly when the endpoints no longer reach
+        // each other
+        std::vector<vertex_t> piece;
+        if ( track_connectivity && !reachable(edge.first, edge.second, &piece) ) { connectivity.split(piece); }
+
+        return Status::SUCCESS;
+    }
+
+    vertex_t Graph::addVertex() {
+        addVertex(next_vertex);
+
+        // Return new vertex
+        return next_vertex - 1;
+    }
+
+    vertex_t Graph::addVertex(grapph::vertex_t vertex) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_VERTEX);
+
+        // Only build a message on failure
+        if ( Graph::tryAddVertex(vertex) != Status::SUCCESS ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " already in graph";
+            throw std::invalid_argument(ss.str().c_str());
+        }
+
+        // Return new vertex
+        return vertex;
+    }
+
+    void Graph::removeVertex(grapph::vertex_t vertex) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::REMOVE_VERTEX);
+
+        // Only build a message on failure
+        if ( Graph::tryRemoveVertex(vertex) != Status::SUCCESS ) {
+            std::stringstream ss;
+            ss << "Vertex "
+                << vertex
+                << " not in graph";
+            throw std::invalid_argument(ss.str().c_str());
+        }
+    }
+
+    edge_t Graph::addEdge(vertex_t first, vertex_t second) {
+        return addEdge({first, second});
+    }
+
+    edge_t Graph::addEdge(edge_t edge) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::ADD_EDGE);
+
+        // Order edge
+        if ( edge.first > edge.second ) {
+            edge = { edge.second, edge.first };
+        }
+
+        // Only build a message on failure
+        Status status = Graph::tryAddEdge(edge);
+        if ( status == Status::VERTEX_NOT_FOUND ) {
+            validate(edge.first);
+            validate(edge.second);
+        } else if ( status == Status::EDGE_EXISTS ) {
+            throw std::invalid_argument("Edge already added");
+        }
 
         return edge;
     }
 
     void Graph::removeEdge(edge_t edge) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::REMOVE_EDGE);
+
         // Order edge
         if ( edge.second < edge.first ) {
             edge = { edge.second, edge.first };
         }
 
-        // Ensure edge in graph
-        if ( edges.count(edge) == 0 ) {
+        // Only build a message on failure
+        if ( Graph::tryRemoveEdge(edge) != Status::SUCCESS ) {
             std::stringstream ss;
             ss << "Edge ("
                 << edge.first << ", " << edge.second
                 << ") not in graph";
             throw std::invalid_argument(ss.str());
         }
-
-        // Remove edge from graph
-        edges.erase(edge);
-        num_edges -= 1;
-
-        // Remove edge vertices from each others' adjacencies
-        vertex_neighbors[edge.first].erase(edge.second);
-        vertex_neighbors[edge.second].erase(edge.first);
     }
 
     bool Graph::adjacent(vertex_t first, vertex_t second) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::ADJACENT);
+
         // Validate vertices
         validate(first);
         validate(second);
@@ -192,10 +508,20 @@ namespace grapph {
     }
 
     std::set<vertex_t> Graph::getNeighbors(vertex_t vertex) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::GET_NEIGHBORS);
+
         // Validate vertex
         validate(vertex);
 
-        return vertex_neighbors[vertex];
+        const vset_t & row = vertex_neighbors[vertex];
+        return std::set<vertex_t>(row.begin(), row.end());
+    }
+
+    const vset_t& Graph::viewNeighbors(vertex_t vertex) const {
+        // Validate vertex
+        validate(vertex);
+
+        return vertex_neighbors.find(vertex)->second;
     }
 
     size_t Graph::getDegree(vertex_t vertex) {
@@ -205,7 +531,162 @@ namespace grapph {
         return vertex_neighbors[vertex].size();
     }
 
-    Graph Graph::induce(std::set<vertex_t> &vertex_subset) {
+    bool Graph::reachable(vertex_t first, vertex_t second, std::vector<vertex_t> * piece) const {
+        if ( first == second ) { return true; }
+
+        std::unordered_map<vertex_t, size_t> side = { { first, 0 }, { second, 1 } };
+        std::vector<vertex_t> queues[2] = { { first }, { second } };
+        size_t heads[2] = { 0, 0 };
+        while ( true ) {
+            for ( size_t s = 0; s < 2; s++ ) {
+                if ( heads[s] == queues[s].size() ) {
+                    if ( piece != nullptr ) { piece->swap(queues[s]); }
+                    return false;
+                }
+            }
+
+            size_t s = queues[0].size() <= queues[1].size() ? 0 : 1;
+            vertex_t vertex = queues[s][heads[s]++];
+            for ( vertex_t neighbor : vertex_neighbors.find(vertex)->second ) {
+                auto found = side.emplace(neighbor, s);
+                if ( found.second ) { queues[s].push_back(neighbor); }
+                else if ( found.first->second != s ) { return true; }
+            }
+        }
+    }
+
+    void Graph::separate(const std::vector<vertex_t> & sources) {
+        // Every source grows a region of its own, one vertex per round; regions
+        // that meet join a group. A group whose frontier runs out is a piece
+        // of its own, and once at most one group is still growing it is the
+        // rest of the old component, so the search stops.
+        size_t count = sources.size();
+        std::vector<size_t> groups(count);
+        std::vector<std::vector<size_t>> members(count);
+        std::vector<size_t> growing(count, 1);
+        std::vector<std::vector<vertex_t>> queues(count);
+        std::vector<size_t> heads(count, 0);
+        std::unordered_map<vertex_t, size_t> owner;
+        for ( size_t s = 0; s < count; s++ ) {
+            groups[s] = s;
+            members[s] = { s };
+            queues[s] = { sources[s] };
+            owner.emplace(sources[s], s);
+        }
+
+        auto group = [&groups](size_t s) {
+            while ( groups[s] != s ) { s = groups[s] = groups[groups[s]]; }
+            return s;
+        };
+
+        size_t live = count;
+        while ( live > 1 ) {
+            for ( size_t s = 0; s < count && live > 1; s++ ) {
+                if ( heads[s] == queues[s].size() ) { continue; }
+
+                vertex_t vertex = queues[s][heads[s]++];
+                for ( vertex_t neighbor : vertex_neighbors.find(vertex)->second ) {
+                    auto found = owner.emplace(neighbor, s);
+                    if ( found.second ) { queues[s].push_back(neighbor); continue; }
+
+                    size_t a = group(s);
+                    size_t b = group(found.first->second);
+                    if ( a == b ) { continue; }
+                    if ( members[a].size() < members[b].size() ) { std::swap(a, b); }
+                    groups[b] = a;
+                    members[a].insert(members[a].end(), members[b].begin(), members[b].end());
+                    members[b].clear();
+                    growing[a] += growing[b];
+                    live--;
+                }
+
+                if ( heads[s] < queues[s].size() ) { continue; }
+                size_t g = group(s);
+                if ( --growing[g] > 0 || live <= 1 ) { continue; }
+
+                std::vector<vertex_t> piece;
+                for ( size_t member : members[g] ) {
+                    piece.insert(piece.end(), queues[member].begin(), queues[member].end());
+                }
+                connectivity.split(piece);
+                live--;
+            }
+        }
+    }
+
+    void Graph::trackConnectivity(bool enabled) {
+        track_connectivity = enabled;
+        connectivity.clear();
+        if ( !enabled ) { return; }
+
+        for ( vertex_t vertex : vertices ) { connectivity.addVertex(vertex); }
+        for ( const edge_t & edge : edges ) { connectivity.unite(edge.first, edge.second); }
+    }
+
+    bool Graph::connected(vertex_t first, vertex_t second) const {
+        // Validate vertices
+        validate(first);
+        validate(second);
+
+        if ( track_connectivity ) { return connectivity.connected(first, second); }
+        return reachable(first, second);
+    }
+
+    size_t Graph::getNumComponents() const {
+        if ( track_connectivity ) { return connectivity.getNumComponents(); }
+
+        ConnectivityIndex index;
+        for ( vertex_t vertex : vertices ) { index.addVertex(vertex); }
+        for ( const edge_t & edge : edges ) { index.unite(edge.first, edge.second); }
+        return index.getNumComponents();
+    }
+
+    std::vector<edge_t> Graph::inducedEdges(const std::vector<vertex_t> & ids, size_t threads) const {
+        // Each worker takes a contiguous run of ids; its edges come out sorted,
+        // so concatenating the runs in order keeps the whole list sorted
+        std::vector<std::vector<edge_t>> found(resolveThreads(threads));
+        parallelFor(0, ids.size(), threads, [&](size_t lo, size_t hi, size_t worker) {
+            std::vector<edge_t> & kept = found[worker];
+            for ( size_t i = lo; i < hi; i++ ) {
+                vertex_t vertex = ids[i];
+                const vset_t & neighbors = vertex_neighbors.find(vertex)->second;
+                auto it = neighbors.lower_bound(vertex);
+                auto candidate = ids.begin() + i;
+                size_t remaining = ids.end() - candidate;
+
+                // Merge the row against the remaining ids when both are about
+                // the same length, otherwise binary search each neighbor
+                size_t probes = 1;
+                for ( size_t span = remaining; span > 1; span >>= 1 ) { probes++; }
+                if ( remaining <= neighbors.size() * probes ) {
+                    while ( it != neighbors.end() && candidate != ids.end() ) {
+                        if ( *it < *candidate ) { it++; }
+                        else if ( *candidate < *it ) { candidate++; }
+                        else { kept.push_back({ vertex, *it }); it++; candidate++; }
+                    }
+                } else {
+                    for ( ; it != neighbors.end(); it++ ) {
+                        candidate = std::lower_bound(candidate, ids.end(), *it);
+                        if ( candidate == ids.end() ) { break; }
+                        if ( *candidate == *it ) { kept.push_back({ vertex, *it }); }
+                    }
+                }
+            }
+        });
+
+        std::vector<edge_t> edge_list = std::move(found[0]);
+        for ( size_t worker = 1; worker < found.size(); worker++ ) {
+            edge_list.insert(edge_list.end(), found[worker].begin(), found[worker].end());
+        }
+        return edge_list;
+    }
+
+    Graph Graph::induce(std::set<vertex_t> &vertex_subset, size_t threads, bool relabel,
+                        std::pmr::memory_resource * resource) {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::INDUCE);
+
+        if ( resource == nullptr ) { resource = getResource(); }
+
         // Assert vertex subset is proper
         for ( vertex_t vertex : vertex_subset ) {
             if ( vertices.count(vertex) == 0 ) {
@@ -214,18 +695,37 @@ namespace grapph {
         }
 
         // If subset, but not proper, return self
-        if ( vertex_subset.size() == vertices.size() ) {
-            return *this;
+        if ( vertex_subset.size() == vertices.size() && !relabel ) {
+            return Graph(*this, resource);
+        }
+
+        // Else, keep each edge whose far endpoint is also in the subset
+        std::vector<vertex_t> ids(vertex_subset.begin(), vertex_subset.end());
+        std::vector<edge_t> edge_list = inducedEdges(ids, threads);
+
+        // Relabeling by rank is monotone, so both lists stay sorted
+        if ( relabel ) {
+            VertexIndex index(ids.begin(), ids.end());
+            for ( edge_t & edge : edge_list ) {
+                edge = { index.indexOf(edge.first), index.indexOf(edge.second) };
+            }
+            for ( size_t i = 0; i < ids.size(); i++ ) { ids[i] = i; }
         }
 
-        // Else, return new induced subgraph
-        std::set<edge_t> edge_space = getEdgeSpace(vertex_subset);
-        Graph induced_subgraph(vertex_subset, setIntersection(edges, edge_space));
+        // Like the full-subset copy, keep tracking connectivity if this graph does
+        Graph induced_subgraph(resource);
+        induced_subgraph.track_connectivity = track_connectivity;
+        induced_subgraph.assign(ids, edge_list);
 
         return induced_subgraph;
     }
 
     bool Graph::contains(Graph & subgraph_candidate) {
+        // A larger graph cannot be contained
+        if ( subgraph_candidate.num_vertices > num_vertices || subgraph_candidate.num_edges > num_edges ) {
+            return false;
+        }
+
         return setContains(vertices, subgraph_candidate.vertices)
                 && setContains(edges, subgraph_candidate.edges);
     }
@@ -236,16 +736,30 @@ namespace grapph {
     }
 
     bool Graph::induces(Graph & induced_subgraph_candidate) {
-        // Generate edge space and necessary induced subgraph edges
-        std::set<edge_t> edge_space = getEdgeSpace(induced_subgraph_candidate.vertices);
-        std::set<edge_t> induced_subgraph_edges = setIntersection(edges, edge_space);
+        if ( !setContains(vertices, induced_subgraph_candidate.vertices) ) { return false; }
+
+        // Compare against the edges this graph induces on the candidate's vertices
+        std::vector<vertex_t> ids(induced_subgraph_candidate.vertices.begin(),
+                                  induced_subgraph_candidate.vertices.end());
+        std::vector<edge_t> induced_subgraph_edges = inducedEdges(ids, 1);
 
-        return setContains(vertices, induced_subgraph_candidate.vertices)
-                && setEquals(induced_subgraph_edges, induced_subgraph_candidate.edges);
+        return induced_subgraph_edges.size() == induced_subgraph_candidate.edges.size()
+                && std::equal(induced_subgraph_edges.begin(), induced_subgraph_edges.end(),
+                              induced_subgraph_candidate.edges.begin());
     }
 
     bool Graph::equals(Graph & candidate) {
-        return contains(candidate) && candidate.contains(*this);
+        GRAPPH_INSTRUMENT_SCOPE(Operation::EQUALS);
+
+        // Reject on counts and fingerprint in O(1)
+        if ( num_vertices != candidate.num_vertices || num_edges != candidate.num_edges
+                || fingerprint != candidate.fingerprint ) {
+            return false;
+        }
+
+        // Fingerprints can collide, so confirm; equal sizes make one sorted pass enough
+        return std::equal(vertices.begin(), vertices.end(), candidate.vertices.begin())
+                && std::equal(edges.begin(), edges.end(), candidate.edges.begin());
     }
 
     std::set<edge_t> Graph::getEdgeSpace(std::set<vertex_t>& vertex_set) {
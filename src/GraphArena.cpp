@@ -0,0 +1,18 @@
+#include "GraphArena.h"
+
+namespace grapph {
+
+    GraphArena::GraphArena(size_t initial_size, std::pmr::memory_resource * upstream)
+            : buffer(initial_size, upstream) {}
+
+    void * GraphArena::do_allocate(size_t bytes, size_t alignment) {
+        bytes_allocated += bytes;
+        return buffer.allocate(bytes, alignment);
+    }
+
+    void GraphArena::release() {
+        buffer.release();
+        bytes_allocated = 0;
+    }
+
+}
@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "GraphArena.h"
+
+#include <random>
+
+// Random vertex subsets of about a quarter of the graph
+static std::vector<std::set<grapph::vertex_t>> randomSubsets(size_t num_vertices, size_t count) {
+    std::mt19937_64 rng(5);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, num_vertices - 1);
+    std::vector<std::set<grapph::vertex_t>> subsets(count);
+    for ( std::set<grapph::vertex_t> & subset : subsets ) {
+        for ( size_t i = 0; i < num_vertices / 4; i++ ) { subset.insert(pick(rng)); }
+    }
+    return subsets;
+}
+
+// Induce a batch of subgraphs, read them and let each be destroyed
+static void BM_InduceDefault(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::vector<std::set<grapph::vertex_t>> subsets = randomSubsets(state.range(0), 16);
+
+    for ( auto _ : state ) {
+        size_t edges = 0;
+        for ( std::set<grapph::vertex_t> & subset : subsets ) {
+            grapph::Graph induced = graph.induce(subset);
+            edges += induced.viewEdges().size();
+        }
+        benchmark::DoNotOptimize(edges);
+    }
+    state.SetItemsProcessed(state.iterations() * subsets.size());
+}
+BENCHMARK(BM_InduceDefault)->Args({1 << 12, 16})->Args({1 << 15, 16})->Unit(benchmark::kMillisecond);
+
+// The same batch built in an arena and dropped with one release
+static void BM_InduceArena(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::vector<std::set<grapph::vertex_t>> subsets = randomSubsets(state.range(0), 16);
+    grapph::GraphArena arena(1 << 20);
+
+    for ( auto _ : state ) {
+        size_t edges = 0;
+        for ( std::set<grapph::vertex_t> & subset : subsets ) {
+            grapph::Graph & induced = arena.create<grapph::Graph>(graph.induce(subset, 1, false, &arena));
+            edges += induced.viewEdges().size();
+        }
+        benchmark::DoNotOptimize(edges);
+        arena.release();
+    }
+    state.SetItemsProcessed(state.iterations() * subsets.size());
+}
+BENCHMARK(BM_InduceArena)->Args({1 << 12, 16})->Args({1 << 15, 16})->Unit(benchmark::kMillisecond);
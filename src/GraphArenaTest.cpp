@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+
+#include "FeatureGraph.h"
+#include "GraphArena.h"
+#include "Homomorphism.h"
+
+#include <string>
+
+// Counts what reaches the upstream resource
+class CountingResource : public std::pmr::memory_resource {
+
+public:
+
+    size_t allocations = 0;
+
+private:
+
+    void * do_allocate(size_t bytes, size_t alignment) override {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void * p, size_t bytes, size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override { return this == &other; }
+
+};
+
+TEST(GraphArenaTest, TestGraphAllocatesFromArena) {
+    grapph::GraphArena arena;
+    grapph::Graph graph({ 1, 2, 3, 4 }, { {1, 2}, {2, 3}, {3, 4} }, &arena);
+
+    // Assertions
+    ASSERT_EQ(&arena, graph.getResource());
+    ASSERT_LT(0, arena.getBytesAllocated());
+    ASSERT_EQ(&arena, graph.viewVertices().get_allocator().resource());
+    ASSERT_EQ(&arena, graph.viewNeighbors(2).get_allocator().resource());
+
+    size_t before = arena.getBytesAllocated();
+    graph.addEdge(1, 4);
+    ASSERT_LT(before, arena.getBytesAllocated());
+    ASSERT_TRUE(graph.adjacent(4, 1));
+}
+
+TEST(GraphArenaTest, TestUpstreamSeesOnlyBlocks) {
+    CountingResource upstream;
+    grapph::GraphArena arena(1 << 12, &upstream);
+
+    grapph::Graph graph(&arena);
+    for ( grapph::vertex_t u = 0; u < 1000; u++ ) {
+        graph.addVertex(u);
+        if ( u > 0 ) { graph.addEdge(u - 1, u); }
+    }
+
+    // Thousands of nodes come out of a handful of geometrically growing blocks
+    ASSERT_LT(0, upstream.allocations);
+    ASSERT_GT(32, upstream.allocations);
+    ASSERT_EQ(999, graph.viewEdges().size());
+}
+
+TEST(GraphArenaTest, TestInduceIntoArena) {
+    grapph::Graph graph({ 1, 2, 3, 4, 5 }, { {1, 2}, {2, 3}, {3, 4}, {4, 5}, {1, 5} });
+    std::set<grapph::vertex_t> subset = { 1, 2, 3, 5 };
+    grapph::GraphArena untracked_arena;
+    graph.induce(subset, 1, false, &untracked_arena);
+    graph.trackConnectivity();
+
+    // Never destroyed, so anything not taken from the arena would leak
+    CountingResource upstream;
+    grapph::GraphArena arena(1 << 12, &upstream);
+    grapph::Graph & induced = arena.create<grapph::Graph>(graph.induce(subset, 1, false, &arena));
+
+    // Assertions
+    ASSERT_EQ(&arena, induced.getResource());
+    ASSERT_EQ(std::pmr::get_default_resource(), graph.getResource());
+    ASSERT_EQ(subset, induced.getVertices());
+    ASSERT_EQ(std::set<grapph::edge_t>({ {1, 2}, {2, 3}, {1, 5} }), induced.getEdges());
+
+    // The connectivity index comes out of the arena along with the structure
+    ASSERT_TRUE(induced.tracksConnectivity());
+    ASSERT_EQ(1, induced.getNumComponents());
+    ASSERT_LT(untracked_arena.getBytesAllocated() + sizeof(grapph::Graph), arena.getBytesAllocated());
+    ASSERT_EQ(1, upstream.allocations);
+
+    // Induced graphs stay in the source's resource by default
+    grapph::Graph nested = induced.induce(subset, 2, true);
+    ASSERT_EQ(&arena, nested.getResource());
+    ASSERT_EQ(3, nested.viewEdges().size());
+    ASSERT_TRUE(nested.tracksConnectivity());
+
+    induced.removeEdge({ 2, 3 });
+    ASSERT_EQ(2, induced.getNumComponents());
+}
+
+TEST(GraphArenaTest, TestInducedHomomorphism) {
+    grapph::Graph graph({ 10, 20, 30, 40 }, { {10, 20}, {20, 30}, {30, 40} });
+    std::set<grapph::vertex_t> subset = { 20, 30, 40 };
+
+    grapph::GraphArena arena;
+    grapph::Graph induced(&arena);
+    grapph::Homomorphism homomorphism = grapph::Homomorphism::induce(graph, subset, induced);
+
+    // Assertions
+    ASSERT_EQ(&arena, induced.getResource());
+    ASSERT_EQ(std::set<grapph::vertex_t>({ 0, 1, 2 }), induced.getVertices());
+    grapph::vertex_t image;
+    ASSERT_EQ(grapph::Status::SUCCESS, homomorphism.tryMapVertex(1, image));
+    ASSERT_EQ(30, image);
+    ASSERT_TRUE(homomorphism.isInjective());
+}
+
+TEST(GraphArenaTest, TestFeatureGraph) {
+    grapph::GraphArena arena;
+    grapph::FeatureGraph<std::string, long int> graph(&arena);
+    graph.addVertex(1, "one");
+    graph.addVertex(2, "two");
+    graph.addEdge({ 2, 1 }, 12);
+
+    // Assertions
+    ASSERT_EQ(&arena, graph.getResource());
+    ASSERT_EQ(&arena, graph.viewVertexStates().get_allocator().resource());
+    ASSERT_EQ(&arena, graph.viewEdgeWeights().get_allocator().resource());
+    ASSERT_EQ("two", graph.getVertexState(2));
+    ASSERT_EQ(12, graph.getEdgeState({ 1, 2 }));
+
+    // Bulk construction into the arena
+    grapph::FeatureGraph<int, int> bulk({ { 3, 30 }, { 1, 10 } }, { { { 3, 1 }, 31 } }, 2, &arena);
+    ASSERT_EQ(&arena, bulk.viewEdgeWeights().get_allocator().resource());
+    ASSERT_EQ(31, bulk.getEdgeState({ 1, 3 }));
+}
+
+TEST(GraphArenaTest, TestCopyOutSurvivesRelease) {
+    grapph::GraphArena arena;
+    grapph::Graph & scratch = arena.create<grapph::Graph>(&arena);
+    for ( grapph::vertex_t u = 0; u < 100; u++ ) {
+        scratch.addVertex(u);
+        if ( u % 2 == 1 ) { scratch.addEdge(u - 1, u); }
+    }
+
+    // Keep a copy on the default resource, then drop the arena wholesale
+    grapph::Graph kept(scratch, std::pmr::get_default_resource());
+    arena.release();
+
+    // Assertions
+    ASSERT_EQ(0, arena.getBytesAllocated());
+    ASSERT_EQ(100, kept.viewVertices().size());
+    ASSERT_EQ(50, kept.viewEdges().size());
+    ASSERT_TRUE(kept.adjacent(98, 99));
+
+    // The arena is reusable after release
+    grapph::Graph & again = arena.create<grapph::Graph>(&arena);
+    again.addVertex(7);
+    ASSERT_TRUE(again.hasVertex(7));
+    ASSERT_LT(0, arena.getBytesAllocated());
+}
@@ -0,0 +1,134 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+
+#include <random>
+
+// Core Graph operations over a sweep of sizes (arg 0) and average degrees
+// (arg 1), so regressions show up against both scale and density
+
+static void BM_GraphAddVertex(benchmark::State & state) {
+    for ( auto _ : state ) {
+        grapph::Graph graph;
+        for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u++ ) {
+            graph.addVertex(u);
+        }
+        benchmark::DoNotOptimize(graph.viewVertices().size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GraphAddVertex)->Arg(1 << 10)->Arg(1 << 14)->Unit(benchmark::kMicrosecond);
+
+// Edges arrive in random order into a graph that has every vertex
+static void BM_GraphAddEdgeRandom(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u++ ) { vertices.insert(u); }
+    grapph::Graph empty(vertices, {});
+
+    for ( auto _ : state ) {
+        state.PauseTiming();
+        grapph::Graph graph = empty;
+        state.ResumeTiming();
+        for ( const grapph::edge_t & edge : edge_list ) { graph.addEdge(edge); }
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphAddEdgeRandom)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
+
+static void BM_GraphRemoveEdge(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::vector<grapph::edge_t> edge_list(graph.viewEdges().begin(), graph.viewEdges().end());
+    std::shuffle(edge_list.begin(), edge_list.end(), std::mt19937_64(3));
+
+    for ( auto _ : state ) {
+        state.PauseTiming();
+        grapph::Graph copy = graph;
+        state.ResumeTiming();
+        for ( const grapph::edge_t & edge : edge_list ) { copy.removeEdge(edge); }
+        benchmark::DoNotOptimize(copy.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphRemoveEdge)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
+
+// Removing a vertex also drops its edges, so cost grows with degree
+static void BM_GraphRemoveVertex(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::vector<grapph::vertex_t> doomed;
+    for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u += 4 ) { doomed.push_back(u); }
+
+    for ( auto _ : state ) {
+        state.PauseTiming();
+        grapph::Graph copy = graph;
+        state.ResumeTiming();
+        for ( grapph::vertex_t u : doomed ) { copy.removeVertex(u); }
+        benchmark::DoNotOptimize(copy.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * doomed.size());
+}
+BENCHMARK(BM_GraphRemoveVertex)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
+
+// getNeighbors returns a copy; BM_GraphNeighborView measures the view
+static void BM_GraphGetNeighbors(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        size_t total = 0;
+        for ( grapph::vertex_t u : graph.viewVertices() ) { total += graph.getNeighbors(u).size(); }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_GraphGetNeighbors)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
+
+static void BM_GraphAdjacentSweep(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::mt19937_64 rng(7);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(graph.adjacent(pick(rng), pick(rng)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GraphAdjacentSweep)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } });
+
+// Arg 2 is the thread count, arg 3 whether to relabel
+static void BM_GraphInduce(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> subset;
+    for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u += 2 ) { subset.insert(u); }
+
+    for ( auto _ : state ) {
+        grapph::Graph induced = graph.induce(subset, state.range(2), state.range(3) != 0);
+        benchmark::DoNotOptimize(induced.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_GraphInduce)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 }, { 1, 4 }, { 0, 1 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Equal graphs share a fingerprint, so every vertex and edge is compared
+static void BM_GraphEquals(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::Graph copy = graph;
+
+    for ( auto _ : state ) { benchmark::DoNotOptimize(graph.equals(copy)); }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_GraphEquals)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMicrosecond);
+
+// One changed edge keeps the sizes but not the fingerprint
+static void BM_GraphNotEquals(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::Graph other = graph;
+    grapph::edge_t edge = *other.viewEdges().begin();
+    other.removeEdge(edge);
+    other.addEdge(edge.first, edge.first);
+
+    for ( auto _ : state ) { benchmark::DoNotOptimize(graph.equals(other)); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GraphNotEquals)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } });
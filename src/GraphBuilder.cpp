@@ -0,0 +1,130 @@
+#include "GraphBuilder.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace grapph {
+
+    GraphBuilder& GraphBuilder::setStrict(bool strict) {
+        this->strict = strict;
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::reserve(size_t num_vertices, size_t num_edges) {
+        vertices.reserve(num_vertices);
+        edges.reserve(num_edges);
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addVertex(vertex_t vertex) {
+        vertices.push_back(vertex);
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addVertices(const std::vector<vertex_t> & vertex_list) {
+        vertices.insert(vertices.end(), vertex_list.begin(), vertex_list.end());
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addVertices(std::vector<vertex_t> && vertex_list) {
+        if ( !vertices.empty() ) { return addVertices(vertex_list); }
+
+        vertices = std::move(vertex_list);
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addEdge(vertex_t first, vertex_t second) {
+        return addEdge({first, second});
+    }
+
+    GraphBuilder& GraphBuilder::addEdge(edge_t edge) {
+        edges.push_back(edge);
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addEdges(const std::vector<edge_t> & edge_list) {
+        edges.insert(edges.end(), edge_list.begin(), edge_list.end());
+        prepared = false;
+        return *this;
+    }
+
+    GraphBuilder& GraphBuilder::addEdges(std::vector<edge_t> && edge_list) {
+        if ( !edges.empty() ) { return addEdges(edge_list); }
+
+        edges = std::move(edge_list);
+        prepared = false;
+        return *this;
+    }
+
+    void GraphBuilder::prepare() {
+        if ( prepared ) { return; }
+
+        // Order each edge
+        parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t i = lo; i < hi; i++ ) {
+                if ( edges[i].first > edges[i].second ) { edges[i] = { edges[i].second, edges[i].first }; }
+            }
+        });
+
+        // Sort so duplicates sit next to each other
+        parallelSort(vertices.begin(), vertices.end(), threads);
+        parallelSort(edges.begin(), edges.end(), threads);
+
+        if ( strict ) {
+            // Report repeats and undeclared endpoints instead of repairing them
+            problems = Graph::checkVertexList(vertices, threads);
+            std::vector<std::string> edge_problems = Graph::checkEdgeList(vertices, edges, threads);
+            problems.insert(problems.end(), edge_problems.begin(), edge_problems.end());
+        } else {
+            // Merge repeats and add every endpoint as a vertex
+            parallelUnique(edges, threads);
+            std::vector<vertex_t> endpoints(2 * edges.size());
+            parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    endpoints[2 * i] = edges[i].first;
+                    endpoints[2 * i + 1] = edges[i].second;
+                }
+            });
+            parallelSort(endpoints.begin(), endpoints.end(), threads);
+            parallelUnique(endpoints, threads);
+            parallelUnique(vertices, threads);
+
+            std::vector<vertex_t> merged;
+            merged.reserve(vertices.size() + endpoints.size());
+            std::set_union(vertices.begin(), vertices.end(), endpoints.begin(), endpoints.end(),
+                           std::back_inserter(merged));
+            vertices.swap(merged);
+            problems.clear();
+        }
+
+        prepared = true;
+    }
+
+    std::vector<std::string> GraphBuilder::validate() {
+        prepare();
+        return problems;
+    }
+
+    Graph GraphBuilder::build() {
+        prepare();
+        Graph::throwIfInvalid(problems);
+
+        Graph graph;
+        graph.assign(vertices, edges);
+        return graph;
+    }
+
+    CompactGraph GraphBuilder::buildCompact() {
+        prepare();
+        Graph::throwIfInvalid(problems);
+
+        return CompactGraph(vertices, edges);
+    }
+
+}
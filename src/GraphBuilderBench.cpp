@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "GraphBuilder.h"
+
+static void BM_GraphSetConstructor(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < static_cast<size_t>(state.range(0)); u++ ) { vertices.insert(u); }
+    std::set<grapph::edge_t> edges(edge_list.begin(), edge_list.end());
+
+    for ( auto _ : state ) {
+        grapph::Graph graph(vertices, edges);
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphSetConstructor)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_GraphAddEdge(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        grapph::Graph graph;
+        for ( grapph::vertex_t u = 0; u < static_cast<size_t>(state.range(0)); u++ ) { graph.addVertex(u); }
+        for ( const grapph::edge_t & edge : edge_list ) { graph.addEdge(edge); }
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphAddEdge)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_GraphBuilder(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        grapph::Graph graph = grapph::GraphBuilder(state.range(2)).addEdges(edge_list).build();
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphBuilder)->Args({1 << 14, 16, 1})->Args({1 << 14, 16, 0})->Unit(benchmark::kMillisecond);
+
+static void BM_GraphBuilderCompact(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        grapph::CompactGraph graph = grapph::GraphBuilder(state.range(2)).addEdges(edge_list).buildCompact();
+        benchmark::DoNotOptimize(graph.getNumEdges());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_GraphBuilderCompact)->Args({1 << 14, 16, 1})->Args({1 << 14, 16, 0})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+
+#include "GraphBuilder.h"
+#include "FeatureGraph.h"
+#include "SetFunctions.h"
+
+#include <random>
+
+TEST(GraphBuilderTest, TestEdgeListImpliesVertices) {
+    // Build from an unsorted edge list with repeats and reversed pairs
+    grapph::Graph graph = grapph::GraphBuilder()
+            .addEdges({ {3, 2}, {0, 2}, {2, 3}, {0, 3}, {2, 0} })
+            .addVertex(7)
+            .build();
+
+    std::set<grapph::vertex_t> vertices = { 0, 2, 3, 7 };
+    std::set<grapph::edge_t> edges = { {0, 2}, {0, 3}, {2, 3} };
+    std::set<grapph::vertex_t> vertex_set = graph.getVertices();
+    std::set<grapph::edge_t> edge_set = graph.getEdges();
+
+    // Assertions
+    ASSERT_TRUE(grapph::setEquals(vertices, vertex_set));
+    ASSERT_TRUE(grapph::setEquals(edges, edge_set));
+    ASSERT_EQ(2, graph.getDegree(0));
+    ASSERT_EQ(0, graph.getDegree(7));
+    ASSERT_TRUE(graph.adjacent(3, 2));
+    ASSERT_EQ(8, graph.addVertex());
+}
+
+TEST(GraphBuilderTest, TestStrictReportsEverything) {
+    // Strict input with a repeated vertex, a repeated edge and two bad endpoints
+    grapph::GraphBuilder builder;
+    builder.setStrict(true)
+            .addVertices({ 0, 1, 2, 2 })
+            .addEdges({ {0, 1}, {1, 0}, {1, 5}, {6, 2} });
+
+    std::vector<std::string> problems = builder.validate();
+
+    // Assertions
+    ASSERT_EQ(4, problems.size());
+    ASSERT_EQ("Vertex 2 already in graph", problems[0]);
+    ASSERT_EQ("Edge (0, 1) already added", problems[1]);
+    ASSERT_EQ("Edge (1, 5): vertex 5 not found in graph", problems[2]);
+    ASSERT_EQ("Edge (2, 6): vertex 6 not found in graph", problems[3]);
+    ASSERT_THROW(builder.build(), std::invalid_argument);
+    ASSERT_THROW(builder.buildCompact(), std::invalid_argument);
+
+    // Relaxing the builder repairs the same input
+    builder.setStrict(false);
+    ASSERT_TRUE(builder.validate().empty());
+    ASSERT_EQ(5, builder.build().getVertices().size());
+}
+
+TEST(GraphBuilderTest, TestParallelMatchesSequential) {
+    // Random edge list large enough to take the threaded paths
+    std::mt19937_64 rng(11);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 999);
+    std::vector<grapph::edge_t> edge_list;
+    for ( size_t i = 0; i < 20000; i++ ) { edge_list.push_back({ pick(rng), pick(rng) }); }
+
+    // Build with one and with four threads
+    grapph::Graph sequential = grapph::GraphBuilder(1).addEdges(edge_list).build();
+    grapph::Graph parallel = grapph::GraphBuilder(4).addEdges(edge_list).build();
+    grapph::CompactGraph compact = grapph::GraphBuilder(4).addEdges(edge_list).buildCompact();
+
+    // Assertions
+    ASSERT_TRUE(sequential.equals(parallel));
+    ASSERT_EQ(sequential.getEdges().size(), compact.getNumEdges());
+    for ( grapph::vertex_t u : sequential.viewVertices() ) {
+        ASSERT_EQ(sequential.getDegree(u), compact.getDegree(u));
+        ASSERT_TRUE(std::equal(sequential.viewNeighbors(u).begin(), sequential.viewNeighbors(u).end(),
+                               compact.viewNeighbors(u).begin()));
+    }
+}
+
+TEST(GraphBuilderTest, TestSetConstructorReportsAll) {
+    // The set-based constructor now checks everything up front
+    try {
+        grapph::Graph graph({ 0, 1 }, { {0, 1}, {1, 0}, {0, 4} });
+        FAIL();
+    } catch ( std::invalid_argument & e ) {
+        std::string message = e.what();
+        ASSERT_NE(std::string::npos, message.find("2 problems"));
+        ASSERT_NE(std::string::npos, message.find("vertex 4 not found"));
+    }
+}
+
+TEST(GraphBuilderTest, TestFeatureGraphParallelConstructor) {
+    // Unsorted vertex and edge lists, built with several threads
+    grapph::FeatureGraph<std::string, long int> graph(
+            {{2, "c"}, {0, "a"}, {1, "b"}},
+            {{{2, 1}, 5}, {{0, 1}, 4}},
+            4);
+
+    // Assertions
+    ASSERT_EQ(3, graph.getVertices().size());
+    ASSERT_EQ("c", graph.getVertexState(2));
+    ASSERT_EQ(5, graph.getEdgeState({1, 2}));
+    ASSERT_EQ(4, graph.getEdgeState({0, 1}));
+    ASSERT_EQ(3, graph.addVertex(std::string("d")));
+    ASSERT_THROW((grapph::FeatureGraph<std::string, long int>({{0, "a"}, {0, "b"}}, {})),
+                 std::invalid_argument);
+}
@@ -0,0 +1,513 @@
+#include "GraphReader.h"
+#include "GraphBuilder.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    namespace {
+
+        // Powers of ten a double holds exactly
+        const double EXACT_POWERS[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+        // Read-only private mapping of a whole file
+        class MappedFile {
+
+        private:
+
+            const char * first = nullptr;
+            size_t length = 0;
+
+        public:
+
+            explicit MappedFile(const std::string & path) {
+                int fd = open(path.c_str(), O_RDONLY);
+                if ( fd < 0 ) {
+                    std::stringstream ss;
+                    ss << "Cannot open " << path;
+                    throw std::invalid_argument(ss.str());
+                }
+
+                struct stat info;
+                if ( fstat(fd, &info) == 0 ) { length = info.st_size; }
+                if ( length > 0 ) {
+                    void * address = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+                    if ( address != MAP_FAILED ) {
+                        first = static_cast<const char*>(address);
+                        madvise(address, length, MADV_SEQUENTIAL);
+                    }
+                }
+                close(fd);
+
+                if ( length > 0 && first == nullptr ) {
+                    std::stringstream ss;
+                    ss << "Cannot map " << path;
+                    throw std::invalid_argument(ss.str());
+                }
+            }
+
+            ~MappedFile() {
+                if ( first != nullptr ) { munmap(const_cast<char*>(first), length); }
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            const char * begin() const { return first; }
+            const char * end() const { return first + length; }
+
+        };
+
+        bool isBlank(char c) {
+            return c == ' ' || c == '\t' || c == '\r';
+        }
+
+        void skipBlanks(const char *& at, const char * end) {
+            while ( at != end && isBlank(*at) ) { at++; }
+        }
+
+        // Past the next newline, or the end
+        const char * nextLine(const char * at, const char * end) {
+            const char * newline = static_cast<const char*>(std::memchr(at, '\n', end - at));
+            return newline == nullptr ? end : newline + 1;
+        }
+
+        bool atLineEnd(const char * at, const char * end) {
+            return at == end || *at == '\n';
+        }
+
+        // Unsigned decimal; false on no digits or overflow
+        bool parseInteger(const char *& at, const char * end, uint64_t & value) {
+            skipBlanks(at, end);
+            const char * start = at;
+            value = 0;
+            while ( at != end && *at >= '0' && *at <= '9' ) {
+                uint64_t digit = *at - '0';
+                if ( value > (std::numeric_limits<uint64_t>::max() - digit) / 10 ) { return false; }
+                value = value * 10 + digit;
+                at++;
+            }
+
+            return at != start;
+        }
+
+        // Decimal with optional sign, fraction and exponent. Up to 19
+        // significant digits with a small exponent take one exact multiply or
+        // divide, which rounds correctly; anything else goes to strtod.
+        bool parseReal(const char *& at, const char * end, double & value) {
+            skipBlanks(at, end);
+            const char * start = at;
+
+            bool negative = at != end && *at == '-';
+            if ( at != end && (*at == '-' || *at == '+') ) { at++; }
+
+            uint64_t mantissa = 0;
+            int digits = 0;
+            int exponent = 0;
+            bool any = false;
+            for ( ; at != end && *at >= '0' && *at <= '9'; at++ ) {
+                any = true;
+                if ( digits < 19 ) {
+                    mantissa = mantissa * 10 + (*at - '0');
+                    digits += mantissa != 0;
+                } else {
+                    exponent++;
+                    digits++;
+                }
+            }
+            if ( at != end && *at == '.' ) {
+                for ( at++; at != end && *at >= '0' && *at <= '9'; at++ ) {
+                    any = true;
+                    if ( digits < 19 ) {
+                        mantissa = mantissa * 10 + (*at - '0');
+                        digits += mantissa != 0;
+                        exponent--;
+                    } else {
+                        digits++;
+                    }
+                }
+            }
+            if ( !any ) { return false; }
+
+            if ( at != end && (*at == 'e' || *at == 'E') ) {
+                const char * mark = at++;
+                bool negative_exponent = at != end && *at == '-';
+                if ( at != end && (*at == '-' || *at == '+') ) { at++; }
+                uint64_t power = 0;
+                if ( !parseInteger(at, end, power) || power > 100000 ) {
+                    at = mark;
+                    return false;
+                }
+                exponent += negative_exponent ? -static_cast<int>(power) : static_cast<int>(power);
+            }
+
+            if ( digits <= 19 && mantissa <= (uint64_t(1) << 53) && exponent >= -22 && exponent <= 22 ) {
+                double result = static_cast<double>(mantissa);
+                result = exponent < 0 ? result / EXACT_POWERS[-exponent] : result * EXACT_POWERS[exponent];
+                value = negative ? -result : result;
+                return true;
+            }
+
+            std::string token(start, at);
+            value = std::strtod(token.c_str(), nullptr);
+            return true;
+        }
+
+        // Where each chunk starts: an even split moved up to line starts
+        std::vector<const char*> splitLines(const char * begin, const char * end, size_t chunks) {
+            std::vector<const char*> starts = { begin };
+            size_t length = end - begin;
+            for ( size_t i = 1; i < chunks; i++ ) {
+                const char * at = begin + length / chunks * i;
+                at = at == begin ? begin : nextLine(at - 1, end);
+                starts.push_back(std::max(at, starts.back()));
+            }
+            starts.push_back(end);
+
+            return starts;
+        }
+
+        // What one worker read from its chunk
+        struct Chunk {
+            std::vector<edge_t> edges;
+            std::vector<double> weights;
+            const char * error = nullptr;
+            std::string reason;
+
+            void fail(const char * at, const std::string & why) {
+                if ( error == nullptr ) {
+                    error = at;
+                    reason = why;
+                }
+            }
+        };
+
+        // Throws for the earliest error across the chunks
+        void throwFirstError(const std::string & path, const char * begin, const std::vector<Chunk> & chunks) {
+            for ( const Chunk & chunk : chunks ) {
+                if ( chunk.error == nullptr ) { continue; }
+
+                std::stringstream ss;
+                ss << path << ":" << std::count(begin, chunk.error, '\n') + 1 << ": " << chunk.reason;
+                throw std::invalid_argument(ss.str());
+            }
+        }
+
+        // Splice the chunks' lists together, copying them in parallel
+        void gather(std::vector<Chunk> & chunks, std::vector<edge_t> & edges, std::vector<double> & weights,
+                    bool weighted, size_t threads) {
+            std::vector<size_t> offsets(chunks.size() + 1, 0);
+            for ( size_t i = 0; i < chunks.size(); i++ ) { offsets[i + 1] = offsets[i] + chunks[i].edges.size(); }
+
+            edges.resize(offsets.back());
+            weights.resize(weighted ? offsets.back() : 0);
+            parallelFor(0, chunks.size(), threads, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    std::copy(chunks[i].edges.begin(), chunks[i].edges.end(), edges.begin() + offsets[i]);
+                    if ( weighted ) {
+                        std::copy(chunks[i].weights.begin(), chunks[i].weights.end(), weights.begin() + offsets[i]);
+                    }
+                    std::vector<edge_t>().swap(chunks[i].edges);
+                    std::vector<double>().swap(chunks[i].weights);
+                }
+            });
+        }
+
+        // Lines of "u v [weight]" pairs
+        void parseEdgeLines(const char * at, const char * end, bool weighted, vertex_t base, vertex_t limit,
+                            Chunk & chunk) {
+            chunk.edges.reserve((end - at) / 8);
+            if ( weighted ) { chunk.weights.reserve((end - at) / 8); }
+
+            for ( const char * line = at; line != end; line = nextLine(line, end) ) {
+                const char * cursor = line;
+                skipBlanks(cursor, end);
+                if ( atLineEnd(cursor, end) || *cursor == '#' || *cursor == '%' ) { continue; }
+
+                uint64_t u;
+                uint64_t v;
+                if ( !parseInteger(cursor, end, u) || !parseInteger(cursor, end, v) ) {
+                    chunk.fail(line, "expected two vertex ids");
+                    return;
+                }
+                if ( u < base || v < base || u - base >= limit || v - base >= limit ) {
+                    chunk.fail(line, "vertex id out of range");
+                    return;
+                }
+                chunk.edges.push_back({ u - base, v - base });
+
+                if ( weighted ) {
+                    double weight;
+                    if ( !parseReal(cursor, end, weight) ) {
+                        chunk.fail(line, "expected a weight");
+                        return;
+                    }
+                    chunk.weights.push_back(weight);
+                }
+            }
+        }
+
+        // Text of the line at, without its newline
+        std::string lineText(const char * at, const char * end) {
+            const char * stop = at;
+            while ( !atLineEnd(stop, end) ) { stop++; }
+            return std::string(at, stop);
+        }
+
+        // Skip comment and blank lines; false at the end of the file
+        bool skipComments(const char *& at, const char * end, char comment) {
+            while ( at != end ) {
+                const char * cursor = at;
+                skipBlanks(cursor, end);
+                if ( !atLineEnd(cursor, end) && *cursor != comment ) { return true; }
+                at = nextLine(at, end);
+            }
+            return false;
+        }
+
+    }
+
+    void GraphReader::parse(const std::string & path, GraphFormat format, bool weighted) {
+        vertices.clear();
+        edges.clear();
+        weights.clear();
+
+        MappedFile file(path);
+        const char * begin = file.begin();
+        const char * end = file.end();
+        size_t workers = resolveThreads(threads);
+        std::vector<Chunk> chunks(workers);
+
+        auto fail = [&](const char * at, const std::string & reason) {
+            chunks[0].fail(at, reason);
+            throwFirstError(path, begin, chunks);
+        };
+
+        if ( format == GraphFormat::EDGE_LIST ) {
+            std::vector<const char*> starts = splitLines(begin, end, workers);
+            parallelFor(0, workers, workers, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    parseEdgeLines(starts[i], starts[i + 1], weighted, 0, std::numeric_limits<vertex_t>::max(),
+                                   chunks[i]);
+                }
+            });
+        } else if ( format == GraphFormat::MATRIX_MARKET ) {
+            // Banner: %%MatrixMarket matrix coordinate <field> <symmetry>
+            std::stringstream banner(lineText(begin, end));
+            std::string tag;
+            std::string object;
+            std::string layout;
+            std::string field;
+            banner >> tag >> object >> layout >> field;
+            std::transform(layout.begin(), layout.end(), layout.begin(), ::tolower);
+            std::transform(field.begin(), field.end(), field.begin(), ::tolower);
+            if ( tag != "%%MatrixMarket" ) { fail(begin, "missing %%MatrixMarket banner"); }
+            if ( layout != "coordinate" ) { fail(begin, "only coordinate matrices are supported"); }
+            if ( field == "complex" ) { fail(begin, "complex matrices are not supported"); }
+            if ( weighted && field == "pattern" ) { fail(begin, "pattern matrix has no weights"); }
+
+            const char * at = nextLine(begin, end);
+            if ( !skipComments(at, end, '%') ) { fail(end, "missing size line"); }
+            const char * size_line = at;
+            uint64_t rows = 0;
+            uint64_t columns = 0;
+            uint64_t entries = 0;
+            if ( !parseInteger(at, end, rows) || !parseInteger(at, end, columns) || !parseInteger(at, end, entries) ) {
+                fail(size_line, "expected rows, columns and entries");
+            }
+            if ( rows != columns ) { fail(size_line, "matrix is not square"); }
+
+            vertices.resize(rows);
+            std::iota(vertices.begin(), vertices.end(), 0);
+
+            const char * body = nextLine(size_line, end);
+            std::vector<const char*> starts = splitLines(body, end, workers);
+            parallelFor(0, workers, workers, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    parseEdgeLines(starts[i], starts[i + 1], weighted, 1, rows, chunks[i]);
+                }
+            });
+        } else {
+            // Header: vertices, edges, then an optional fmt and ncon
+            const char * at = begin;
+            if ( !skipComments(at, end, '%') ) { fail(end, "missing header line"); }
+            const char * header_line = at;
+            uint64_t n = 0;
+            uint64_t m = 0;
+            if ( !parseInteger(at, end, n) || !parseInteger(at, end, m) ) {
+                fail(header_line, "expected vertex and edge counts");
+            }
+            uint64_t fmt = 0;
+            uint64_t ncon = 0;
+            skipBlanks(at, end);
+            if ( !atLineEnd(at, end) ) {
+                const char * fmt_start = at;
+                parseInteger(at, end, fmt);
+                if ( at - fmt_start > 3 || fmt % 10 > 1 || fmt / 10 % 10 > 1 || fmt / 100 > 1 ) {
+                    fail(header_line, "bad fmt field");
+                }
+                skipBlanks(at, end);
+                if ( !atLineEnd(at, end) ) { parseInteger(at, end, ncon); }
+            }
+            bool sizes = fmt / 100 == 1;
+            bool edge_weights = fmt % 10 == 1;
+            if ( fmt / 10 % 10 == 1 && ncon == 0 ) { ncon = 1; }
+            if ( weighted && !edge_weights ) { fail(header_line, "no edge weights"); }
+
+            vertices.resize(n);
+            std::iota(vertices.begin(), vertices.end(), 0);
+
+            // Lines are vertices, so each chunk needs the number of lines
+            // before it; count them first
+            const char * body = nextLine(header_line, end);
+            std::vector<const char*> starts = splitLines(body, end, workers);
+            std::vector<size_t> first_vertex(workers + 1, 0);
+            parallelFor(0, workers, workers, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    size_t lines = 0;
+                    for ( const char * line = starts[i]; line != starts[i + 1]; line = nextLine(line, end) ) {
+                        lines += *line != '%';
+                    }
+                    first_vertex[i + 1] = lines;
+                }
+            });
+            std::partial_sum(first_vertex.begin(), first_vertex.end(), first_vertex.begin());
+
+            parallelFor(0, workers, workers, [&](size_t lo, size_t hi, size_t) {
+                for ( size_t i = lo; i < hi; i++ ) {
+                    Chunk & chunk = chunks[i];
+                    chunk.edges.reserve((starts[i + 1] - starts[i]) / 8);
+                    size_t u = first_vertex[i];
+                    for ( const char * line = starts[i]; line != starts[i + 1]; line = nextLine(line, end) ) {
+                        if ( *line == '%' ) { continue; }
+
+                        const char * cursor = line;
+                        skipBlanks(cursor, end);
+                        if ( u >= n ) {
+                            if ( !atLineEnd(cursor, end) ) {
+                                chunk.fail(line, "more vertex lines than the header declares");
+                                break;
+                            }
+                            continue;
+                        }
+
+                        // Skip the vertex size and weights
+                        uint64_t skipped;
+                        bool ok = !sizes || parseInteger(cursor, end, skipped);
+                        for ( uint64_t k = 0; ok && k < ncon; k++ ) { ok = parseInteger(cursor, end, skipped); }
+
+                        skipBlanks(cursor, end);
+                        while ( ok && !atLineEnd(cursor, end) ) {
+                            uint64_t v;
+                            if ( !parseInteger(cursor, end, v) || v == 0 || v > n ) {
+                                ok = false;
+                                break;
+                            }
+                            chunk.edges.push_back({ u, v - 1 });
+                            if ( edge_weights ) {
+                                uint64_t weight;
+                                if ( !parseInteger(cursor, end, weight) ) {
+                                    ok = false;
+                                    break;
+                                }
+                                if ( weighted ) { chunk.weights.push_back(weight); }
+                            }
+                            skipBlanks(cursor, end);
+                        }
+                        if ( !ok ) {
+                            chunk.fail(line, "bad adjacency line");
+                            break;
+                        }
+                        u++;
+                    }
+                }
+            });
+            if ( first_vertex.back() < n ) { fail(end, "fewer vertex lines than the header declares"); }
+        }
+
+        throwFirstError(path, begin, chunks);
+        gather(chunks, edges, weights, weighted, workers);
+    }
+
+    void GraphReader::prepareWeighted() {
+        // Order each edge, then sort edge ids so repeats sit together with
+        // the first one read leading
+        std::vector<size_t> order(edges.size());
+        parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t i = lo; i < hi; i++ ) {
+                if ( edges[i].first > edges[i].second ) { edges[i] = { edges[i].second, edges[i].first }; }
+                order[i] = i;
+            }
+        });
+        parallelSort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return edges[a] != edges[b] ? edges[a] < edges[b] : a < b;
+        }, threads);
+
+        std::vector<edge_t> merged_edges;
+        std::vector<double> merged_weights;
+        merged_edges.reserve(edges.size());
+        merged_weights.reserve(edges.size());
+        for ( size_t k = 0; k < order.size(); k++ ) {
+            if ( k > 0 && edges[order[k]] == edges[order[k - 1]] ) { continue; }
+            merged_edges.push_back(edges[order[k]]);
+            merged_weights.push_back(weights[order[k]]);
+        }
+        edges.swap(merged_edges);
+        weights.swap(merged_weights);
+
+        // Endpoints join the declared vertices
+        std::vector<vertex_t> endpoints(2 * edges.size());
+        parallelFor(0, edges.size(), threads, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t i = lo; i < hi; i++ ) {
+                endpoints[2 * i] = edges[i].first;
+                endpoints[2 * i + 1] = edges[i].second;
+            }
+        });
+        parallelSort(endpoints.begin(), endpoints.end(), threads);
+        parallelUnique(endpoints, threads);
+
+        std::vector<vertex_t> merged;
+        merged.reserve(vertices.size() + endpoints.size());
+        std::set_union(vertices.begin(), vertices.end(), endpoints.begin(), endpoints.end(),
+                       std::back_inserter(merged));
+        vertices.swap(merged);
+    }
+
+    Graph GraphReader::read(const std::string & path, GraphFormat format) {
+        parse(path, format, false);
+
+        GraphBuilder builder(threads);
+        builder.addVertices(std::move(vertices)).addEdges(std::move(edges));
+        vertices.clear();
+        edges.clear();
+
+        return builder.build();
+    }
+
+    CompactGraph GraphReader::readCompact(const std::string & path, GraphFormat format) {
+        parse(path, format, false);
+
+        GraphBuilder builder(threads);
+        builder.addVertices(std::move(vertices)).addEdges(std::move(edges));
+        vertices.clear();
+        edges.clear();
+
+        return builder.buildCompact();
+    }
+
+}
@@ -0,0 +1,72 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "GraphReader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+// Edge list file of a random graph, with weights in the third column
+static std::string writeEdgeList(size_t n, size_t degree) {
+    std::string path = "grapph_bench_edges.txt";
+    std::ofstream out(path, std::ios::trunc);
+    for ( const grapph::edge_t & edge : randomEdgeList(n, degree) ) {
+        out << edge.first << '\t' << edge.second << '\t' << (edge.first ^ edge.second) % 1000 / 8.0 << '\n';
+    }
+
+    return path;
+}
+
+static size_t fileSize(const std::string & path) {
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    return in.tellg();
+}
+
+// Parsing with istream, the usual baseline
+static void BM_ReadEdgeListStream(benchmark::State & state) {
+    std::string path = writeEdgeList(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        std::ifstream in(path);
+        std::vector<grapph::edge_t> edges;
+        grapph::vertex_t u;
+        grapph::vertex_t w;
+        double weight;
+        while ( in >> u >> w >> weight ) { edges.push_back({ u, w }); }
+        benchmark::DoNotOptimize(edges.data());
+    }
+    state.SetBytesProcessed(state.iterations() * fileSize(path));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReadEdgeListStream)->Args({1 << 17, 16})->Unit(benchmark::kMillisecond);
+
+// Arg 2 is the thread count
+static void BM_ReadEdgeList(benchmark::State & state) {
+    std::string path = writeEdgeList(state.range(0), state.range(1));
+    grapph::GraphReader reader(state.range(2));
+
+    for ( auto _ : state ) {
+        grapph::CompactGraph graph = reader.readCompact(path, grapph::GraphFormat::EDGE_LIST);
+        benchmark::DoNotOptimize(graph.getNumEdges());
+    }
+    state.SetBytesProcessed(state.iterations() * fileSize(path));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReadEdgeList)->ArgsProduct({ { 1 << 17 }, { 16 }, { 1, 4 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ReadWeightedEdgeList(benchmark::State & state) {
+    std::string path = writeEdgeList(state.range(0), state.range(1));
+    grapph::GraphReader reader(state.range(2));
+
+    for ( auto _ : state ) {
+        grapph::FeatureGraph<int, double> graph =
+                reader.readFeatures<int, double>(path, grapph::GraphFormat::EDGE_LIST);
+        benchmark::DoNotOptimize(graph.viewEdges().size());
+    }
+    state.SetBytesProcessed(state.iterations() * fileSize(path));
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_ReadWeightedEdgeList)->ArgsProduct({ { 1 << 17 }, { 16 }, { 1, 4 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,177 @@
+#include "gtest/gtest.h"
+
+#include "GraphReader.h"
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+static std::string writeFile(const std::string & name, const std::string & contents) {
+    std::string path = testing::TempDir() + "grapph_" + name;
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << contents;
+    return path;
+}
+
+TEST(GraphReaderTest, TestEdgeList) {
+    // Comments, blank lines, CRLF, a repeated reversed edge, a self loop, extra columns
+    std::string path = writeFile("edges.txt",
+            "# Directed graph: test\n"
+            "# FromNodeId\tToNodeId\n"
+            "1\t2\n"
+            "\n"
+            "2 3 17\r\n"
+            "3\t1\n"
+            "  2 1\n"
+            "% another comment\n"
+            "40 40\n"
+            "3 40");
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::GraphReader reader(threads);
+        grapph::Graph graph = reader.read(path, grapph::GraphFormat::EDGE_LIST);
+
+        // Assertions
+        ASSERT_EQ(std::set<grapph::vertex_t>({ 1, 2, 3, 40 }), graph.getVertices());
+        ASSERT_EQ(std::set<grapph::edge_t>({ {1, 2}, {1, 3}, {2, 3}, {3, 40}, {40, 40} }), graph.getEdges());
+
+        grapph::CompactGraph compact = reader.readCompact(path, grapph::GraphFormat::EDGE_LIST);
+        ASSERT_EQ(graph.getEdges(), compact.getEdges());
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(GraphReaderTest, TestWeightedEdgeList) {
+    // The first weight read for a repeated edge wins
+    std::string path = writeFile("weighted.txt", "0 1 0.5\n1 2 -2e1\n1 0 9\n2 2 1.25E-2\n3 0 12345678901234567890\n");
+
+    for ( size_t threads : { 1, 3 } ) {
+        grapph::FeatureGraph<int, double> graph =
+                grapph::GraphReader(threads).readFeatures<int, double>(path, grapph::GraphFormat::EDGE_LIST, 7);
+
+        // Assertions
+        ASSERT_EQ(4, graph.getVertices().size());
+        ASSERT_EQ(7, graph.getVertexState(2));
+        ASSERT_DOUBLE_EQ(0.5, graph.getEdgeState({0, 1}));
+        ASSERT_DOUBLE_EQ(-20.0, graph.getEdgeState({1, 2}));
+        ASSERT_DOUBLE_EQ(0.0125, graph.getEdgeState({2, 2}));
+        ASSERT_DOUBLE_EQ(12345678901234567890.0, graph.getEdgeState({0, 3}));
+    }
+
+    std::string unweighted = writeFile("unweighted.txt", "0 1\n");
+    ASSERT_THROW((grapph::GraphReader().readFeatures<int, double>(unweighted, grapph::GraphFormat::EDGE_LIST)),
+                 std::invalid_argument);
+
+    std::remove(path.c_str());
+    std::remove(unweighted.c_str());
+}
+
+TEST(GraphReaderTest, TestMatrixMarket) {
+    std::string path = writeFile("matrix.mtx",
+            "%%MatrixMarket matrix coordinate real symmetric\n"
+            "% 5 rows, one of them empty\n"
+            "5 5 4\n"
+            "2 1 1.5\n"
+            "3 2 2.5\n"
+            "4 4 3.0\n"
+            "4 1 4.0\n");
+
+    grapph::Graph graph = grapph::GraphReader(2).read(path, grapph::GraphFormat::MATRIX_MARKET);
+
+    // Assertions
+    ASSERT_EQ(std::set<grapph::vertex_t>({ 0, 1, 2, 3, 4 }), graph.getVertices());
+    ASSERT_EQ(std::set<grapph::edge_t>({ {0, 1}, {1, 2}, {3, 3}, {0, 3} }), graph.getEdges());
+
+    grapph::FeatureGraph<int, float> weighted =
+            grapph::GraphReader().readFeatures<int, float>(path, grapph::GraphFormat::MATRIX_MARKET);
+    ASSERT_EQ(5, weighted.getVertices().size());
+    ASSERT_FLOAT_EQ(2.5f, weighted.getEdgeState({1, 2}));
+
+    // Pattern matrices have no weights, and entries must fit the size line
+    std::string pattern = writeFile("pattern.mtx", "%%MatrixMarket matrix coordinate pattern general\n3 3 1\n1 3\n");
+    ASSERT_EQ(1, grapph::GraphReader().read(pattern, grapph::GraphFormat::MATRIX_MARKET).getEdges().size());
+    ASSERT_THROW((grapph::GraphReader().readFeatures<int, float>(pattern, grapph::GraphFormat::MATRIX_MARKET)),
+                 std::invalid_argument);
+    std::string outside = writeFile("outside.mtx", "%%MatrixMarket matrix coordinate pattern general\n3 3 1\n1 4\n");
+    ASSERT_THROW(grapph::GraphReader().read(outside, grapph::GraphFormat::MATRIX_MARKET), std::invalid_argument);
+    std::string dense = writeFile("dense.mtx", "%%MatrixMarket matrix array real general\n2 2\n1\n2\n3\n4\n");
+    ASSERT_THROW(grapph::GraphReader().read(dense, grapph::GraphFormat::MATRIX_MARKET), std::invalid_argument);
+
+    for ( const std::string & file : { path, pattern, outside, dense } ) { std::remove(file.c_str()); }
+}
+
+TEST(GraphReaderTest, TestMetis) {
+    // Vertex 4 is isolated, and its line is blank
+    std::string path = writeFile("graph.metis",
+            "% comment\n"
+            "5 4 1\n"
+            "2 3 3 1\n"
+            "1 3 3 8\n"
+            "% comment between vertex lines\n"
+            "1 1 2 8 5 2\n"
+            "\n"
+            "3 2\n");
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::GraphReader reader(threads);
+        grapph::Graph graph = reader.read(path, grapph::GraphFormat::METIS);
+
+        // Assertions
+        ASSERT_EQ(std::set<grapph::vertex_t>({ 0, 1, 2, 3, 4 }), graph.getVertices());
+        ASSERT_EQ(std::set<grapph::edge_t>({ {0, 1}, {0, 2}, {1, 2}, {2, 4} }), graph.getEdges());
+
+        grapph::FeatureGraph<int, int> weighted = reader.readFeatures<int, int>(path, grapph::GraphFormat::METIS);
+        ASSERT_EQ(8, weighted.getEdgeState({1, 2}));
+        ASSERT_EQ(2, weighted.getEdgeState({2, 4}));
+    }
+
+    // Vertex weights are skipped, and line counts must match the header
+    std::string vertex_weights = writeFile("vertex_weights.metis", "3 1 10\n5 2\n7 1\n9\n");
+    ASSERT_EQ(1, grapph::GraphReader().read(vertex_weights, grapph::GraphFormat::METIS).getEdges().size());
+    std::string short_file = writeFile("short.metis", "3 1\n2\n1\n");
+    ASSERT_THROW(grapph::GraphReader().read(short_file, grapph::GraphFormat::METIS), std::invalid_argument);
+    std::string unweighted = writeFile("unweighted.metis", "2 1\n2\n1\n");
+    ASSERT_THROW((grapph::GraphReader().readFeatures<int, int>(unweighted, grapph::GraphFormat::METIS)),
+                 std::invalid_argument);
+
+    for ( const std::string & file : { path, vertex_weights, short_file, unweighted } ) { std::remove(file.c_str()); }
+}
+
+TEST(GraphReaderTest, TestErrors) {
+    ASSERT_THROW(grapph::GraphReader().read(testing::TempDir() + "grapph_missing", grapph::GraphFormat::EDGE_LIST),
+                 std::invalid_argument);
+
+    // The message names the offending line
+    std::string path = writeFile("bad.txt", "1 2\n2 3\n3 x\n4 5\n");
+    try {
+        grapph::GraphReader(2).read(path, grapph::GraphFormat::EDGE_LIST);
+        FAIL();
+    } catch ( const std::invalid_argument & e ) {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find(":3:"));
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(GraphReaderTest, TestLargeRandomInput) {
+    // Enough lines that every thread gets several chunks' worth
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 999);
+    std::set<grapph::edge_t> expected;
+    std::stringstream contents;
+    for ( size_t i = 0; i < 20000; i++ ) {
+        grapph::vertex_t u = pick(rng);
+        grapph::vertex_t w = pick(rng);
+        expected.insert({ std::min(u, w), std::max(u, w) });
+        contents << u << (i % 2 ? " " : "\t") << w << "\n";
+    }
+    std::string path = writeFile("large.txt", contents.str());
+
+    // Assertions
+    for ( size_t threads : { 1, 3, 8 } ) {
+        ASSERT_EQ(expected, grapph::GraphReader(threads).read(path, grapph::GraphFormat::EDGE_LIST).getEdges());
+    }
+
+    std::remove(path.c_str());
+}
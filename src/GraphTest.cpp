@@ -426,3 +426,312 @@ TEST(GraphTest, TestRemoveEdge1) {
 }
 
 
+
+TEST(GraphTest, TestViews) {
+    // Initialize graph
+    std::set<grapph::vertex_t> vertices = { 0, 1, 2, 3 };
+    std::set<grapph::edge_t> edges = { {0, 1}, {0, 2}, {2, 3} };
+    grapph::Graph graph(vertices, edges);
+
+    // Views alias internal storage
+    const grapph::vset_t & vertex_view = graph.viewVertices();
+    const grapph::eset_t & edge_view = graph.viewEdges();
+    const grapph::vset_t & neighbor_view = graph.viewNeighbors(0);
+
+    // Assertions
+    ASSERT_TRUE(grapph::setEquals(vertices, vertex_view));
+    ASSERT_TRUE(grapph::setEquals(edges, edge_view));
+    ASSERT_EQ(2, neighbor_view.size());
+    ASSERT_EQ(&neighbor_view, &graph.viewNeighbors(0));
+    ASSERT_THROW(graph.viewNeighbors(4), std::invalid_argument);
+
+    // Views reflect later mutation
+    graph.addEdge(0, 3);
+    ASSERT_EQ(3, neighbor_view.size());
+    ASSERT_EQ(4, edge_view.size());
+}
+
+TEST(GraphTest, TestRemoveVertexSelfLoop) {
+    // Initialize graph with a self loop
+    grapph::Graph graph({ 0, 1 }, { {0, 0}, {0, 1} });
+
+    // Remove looped vertex
+    graph.removeVertex(0);
+
+    // Assertions
+    ASSERT_EQ(1, graph.getVertices().size());
+    ASSERT_EQ(0, graph.getEdges().size());
+    ASSERT_EQ(0, graph.getDegree(1));
+}
+
+TEST(GraphTest, TestTryApi) {
+    // Initialize graph
+    grapph::Graph graph;
+
+    // Vertices
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryAddVertex(0));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryAddVertex(1));
+    ASSERT_EQ(grapph::Status::VERTEX_EXISTS, graph.tryAddVertex(1));
+    ASSERT_TRUE(graph.hasVertex(1));
+    ASSERT_FALSE(graph.hasVertex(2));
+    ASSERT_EQ(2, graph.addVertex());
+
+    // Edges
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryAddEdge(1, 0));
+    ASSERT_EQ(grapph::Status::EDGE_EXISTS, graph.tryAddEdge({0, 1}));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_FOUND, graph.tryAddEdge(0, 5));
+    ASSERT_TRUE(graph.hasEdge(0, 1));
+    ASSERT_TRUE(graph.hasEdge({1, 0}));
+    ASSERT_FALSE(graph.hasEdge(1, 2));
+    ASSERT_TRUE(graph.adjacent(0, 1));
+
+    // Removal
+    ASSERT_EQ(grapph::Status::EDGE_NOT_FOUND, graph.tryRemoveEdge({1, 2}));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryRemoveEdge({1, 0}));
+    ASSERT_FALSE(graph.hasEdge(0, 1));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_FOUND, graph.tryRemoveVertex(7));
+    ASSERT_EQ(grapph::Status::SUCCESS, graph.tryRemoveVertex(2));
+    ASSERT_EQ(2, graph.getVertices().size());
+    ASSERT_EQ(0, graph.getEdges().size());
+
+    // Throwing API still throws
+    ASSERT_THROW(graph.addVertex(1), std::invalid_argument);
+    ASSERT_THROW(graph.removeVertex(2), std::invalid_argument);
+    ASSERT_THROW(graph.addEdge(0, 5), std::invalid_argument);
+    ASSERT_THROW(graph.removeEdge({0, 1}), std::invalid_argument);
+}
+
+TEST(GraphTest, TestInduceLarge) {
+
+    // Initialize circulant graph with chords of length 1, 2 and 7
+    grapph::Graph graph;
+    for ( grapph::vertex_t u = 0; u < 500; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < 500; u++ ) {
+        graph.addEdge(u, (u + 1) % 500);
+        graph.addEdge(u, (u + 2) % 500);
+        graph.addEdge(u, (u + 7) % 500);
+    }
+
+    // Induce on every third vertex plus a dense block
+    std::set<grapph::vertex_t> subset;
+    for ( grapph::vertex_t u = 0; u < 500; u += 3 ) { subset.insert(u); }
+    for ( grapph::vertex_t u = 100; u < 140; u++ ) { subset.insert(u); }
+
+    std::set<grapph::edge_t> expected;
+    for ( const grapph::edge_t & edge : graph.getEdges() ) {
+        if ( subset.count(edge.first) != 0 && subset.count(edge.second) != 0 ) { expected.insert(edge); }
+    }
+
+    grapph::Graph serial = graph.induce(subset);
+    grapph::Graph parallel = graph.induce(subset, 4);
+
+    // Assertions
+    ASSERT_TRUE(grapph::setEquals(subset, serial.getVertices()));
+    ASSERT_TRUE(grapph::setEquals(expected, serial.getEdges()));
+    ASSERT_TRUE(serial.equals(parallel));
+    ASSERT_TRUE(graph.induces(serial));
+    ASSERT_EQ(expected.size(), serial.getEdges().size());
+    ASSERT_EQ(499, serial.addVertex());
+
+    serial.removeEdge(*expected.begin());
+    ASSERT_FALSE(graph.induces(serial));
+}
+
+TEST(GraphTest, TestInduceRelabel) {
+
+    // Initialize path with gaps in its vertex ids
+    grapph::Graph path({ 2, 5, 9, 11 }, { {2, 5}, {5, 9}, {9, 11} });
+
+    // Induce without the first vertex and relabel
+    std::set<grapph::vertex_t> subset = { 5, 9, 11 };
+    grapph::Graph relabeled = path.induce(subset, 1, true);
+
+    // Assertions
+    std::set<grapph::vertex_t> expected_vertices = { 0, 1, 2 };
+    std::set<grapph::edge_t> expected_edges = { {0, 1}, {1, 2} };
+    ASSERT_TRUE(grapph::setEquals(expected_vertices, relabeled.getVertices()));
+    ASSERT_TRUE(grapph::setEquals(expected_edges, relabeled.getEdges()));
+}
+
+TEST(GraphTest, TestFingerprint) {
+
+    // Build the same graph in two different orders
+    grapph::Graph forward;
+    for ( grapph::vertex_t u = 0; u < 5; u++ ) { forward.addVertex(u); }
+    forward.addEdge(0, 1);
+    forward.addEdge(1, 2);
+    forward.addEdge(3, 4);
+
+    grapph::Graph backward;
+    for ( grapph::vertex_t u = 5; u > 0; u-- ) { backward.addVertex(u - 1); }
+    backward.addEdge(4, 3);
+    backward.addEdge(2, 1);
+    backward.addEdge(1, 0);
+
+    grapph::Graph bulk({ 0, 1, 2, 3, 4 }, { {0, 1}, {1, 2}, {3, 4} });
+
+    // Assertions
+    ASSERT_EQ(forward.getFingerprint(), backward.getFingerprint());
+    ASSERT_EQ(forward.getFingerprint(), bulk.getFingerprint());
+    ASSERT_TRUE(forward.equals(backward));
+    ASSERT_TRUE(forward.equals(bulk));
+
+    // Same counts, different edge
+    grapph::Graph other({ 0, 1, 2, 3, 4 }, { {0, 1}, {1, 2}, {2, 4} });
+    ASSERT_NE(forward.getFingerprint(), other.getFingerprint());
+    ASSERT_FALSE(forward.equals(other));
+
+    // Changes that are undone restore the fingerprint
+    uint64_t before = forward.getFingerprint();
+    forward.addVertex(9);
+    forward.addEdge(9, 0);
+    forward.addEdge(9, 9);
+    ASSERT_NE(before, forward.getFingerprint());
+    forward.removeVertex(9);
+    ASSERT_EQ(before, forward.getFingerprint());
+    forward.removeEdge({1, 0});
+    forward.addEdge(0, 1);
+    ASSERT_EQ(before, forward.getFingerprint());
+    ASSERT_EQ(0, grapph::Graph().getFingerprint());
+}
+
+TEST(GraphTest, TestConnectivity) {
+    // Initialize two paths, 0 - 1 - 2 and 3 - 4, and an isolated vertex
+    grapph::Graph graph({ 0, 1, 2, 3, 4, 5 }, { {0, 1}, {1, 2}, {3, 4} });
+
+    // Assertions without the index
+    ASSERT_FALSE(graph.tracksConnectivity());
+    ASSERT_TRUE(graph.connected(0, 2));
+    ASSERT_FALSE(graph.connected(0, 3));
+    ASSERT_TRUE(graph.connected(5, 5));
+    ASSERT_EQ(3, graph.getNumComponents());
+    ASSERT_THROW(graph.connected(0, 9), std::invalid_argument);
+
+    // Merge components through added edges and vertices
+    graph.trackConnectivity();
+    ASSERT_EQ(3, graph.getNumComponents());
+    graph.addEdge(2, 3);
+    graph.addVertex(9);
+    graph.addEdge(9, 5);
+    ASSERT_EQ(2, graph.getNumComponents());
+    ASSERT_TRUE(graph.connected(0, 4));
+    ASSERT_TRUE(graph.connected(9, 5));
+    ASSERT_FALSE(graph.connected(4, 9));
+
+    // A cycle edge does not split; a bridge does
+    graph.addEdge(0, 4);
+    graph.removeEdge({2, 3});
+    ASSERT_EQ(2, graph.getNumComponents());
+    ASSERT_TRUE(graph.connected(2, 3));
+    graph.removeEdge({0, 4});
+    ASSERT_EQ(3, graph.getNumComponents());
+    ASSERT_FALSE(graph.connected(2, 3));
+    ASSERT_TRUE(graph.connected(1, 2));
+    ASSERT_TRUE(graph.connected(3, 4));
+
+    // Removing a cut vertex leaves its neighbors apart
+    graph.addEdge(1, 1);
+    graph.removeVertex(1);
+    ASSERT_EQ(4, graph.getNumComponents());
+    ASSERT_FALSE(graph.connected(0, 2));
+
+    // Copies carry the index; turning it off falls back to searching
+    grapph::Graph copy = graph;
+    copy.addEdge(0, 2);
+    ASSERT_TRUE(copy.connected(0, 2));
+    ASSERT_FALSE(graph.connected(0, 2));
+    graph.trackConnectivity(false);
+    ASSERT_EQ(4, graph.getNumComponents());
+}
+
+TEST(GraphTest, TestConnectivityRemoveHub) {
+    // Hub 0 joins a path on 1..100, pairs on 101..200, lone leaves on
+    // 201..300, and a triangle on 301..303 sits apart
+    grapph::Graph graph;
+    graph.trackConnectivity();
+    for ( grapph::vertex_t u = 0; u <= 303; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 1; u <= 300; u++ ) { graph.addEdge(0, u); }
+    for ( grapph::vertex_t u = 2; u <= 100; u++ ) { graph.addEdge(u - 1, u); }
+    for ( grapph::vertex_t u = 101; u <= 200; u += 2 ) { graph.addEdge(u, u + 1); }
+    graph.addEdge(301, 302);
+    graph.addEdge(302, 303);
+    graph.addEdge(301, 303);
+    ASSERT_EQ(2, graph.getNumComponents());
+
+    // Assertions; every piece the hub held together splits off
+    graph.removeVertex(0);
+    ASSERT_EQ(1 + 50 + 100 + 1, graph.getNumComponents());
+    ASSERT_TRUE(graph.connected(1, 100));
+    ASSERT_TRUE(graph.connected(101, 102));
+    ASSERT_FALSE(graph.connected(102, 103));
+    ASSERT_FALSE(graph.connected(100, 201));
+    ASSERT_TRUE(graph.connected(301, 303));
+
+    // The pieces merge back as usual
+    graph.addVertex(0);
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 201);
+    ASSERT_EQ(1 + 50 + 99 + 1, graph.getNumComponents());
+    ASSERT_TRUE(graph.connected(100, 201));
+}
+
+TEST(GraphTest, TestInduceKeepsConnectivity) {
+    // Path 0 - 1 - 2 - 3 with its index on
+    grapph::Graph graph({ 0, 1, 2, 3 }, { {0, 1}, {1, 2}, {2, 3} });
+    graph.trackConnectivity();
+    std::set<grapph::vertex_t> all = { 0, 1, 2, 3 };
+    std::set<grapph::vertex_t> ends = { 0, 1, 3 };
+
+    // Assertions; full and proper subsets behave alike
+    grapph::Graph copy = graph.induce(all);
+    grapph::Graph proper = graph.induce(ends);
+    grapph::Graph relabeled = graph.induce(ends, 1, true);
+    ASSERT_TRUE(copy.tracksConnectivity());
+    ASSERT_TRUE(proper.tracksConnectivity());
+    ASSERT_TRUE(relabeled.tracksConnectivity());
+    ASSERT_EQ(2, proper.getNumComponents());
+    ASSERT_FALSE(proper.connected(1, 3));
+    proper.addEdge(1, 3);
+    ASSERT_TRUE(proper.connected(0, 3));
+    ASSERT_EQ(2, relabeled.getNumComponents());
+
+    graph.trackConnectivity(false);
+    ASSERT_FALSE(graph.induce(all).tracksConnectivity());
+    ASSERT_FALSE(graph.induce(ends).tracksConnectivity());
+}
+
+TEST(GraphTest, TestConnectivityRandom) {
+    // Random edge churn on 200 vertices, checked against an untracked copy
+    grapph::Graph tracked;
+    grapph::Graph plain;
+    tracked.trackConnectivity();
+    for ( grapph::vertex_t u = 0; u < 200; u++ ) {
+        tracked.addVertex(u);
+        plain.addVertex(u);
+    }
+
+    srand(17);
+    for ( size_t step = 0; step < 3000; step++ ) {
+        grapph::vertex_t u = rand() % 200;
+        grapph::vertex_t w = rand() % 200;
+        if ( step % 3 == 2 && tracked.hasEdge(u, w) ) {
+            tracked.removeEdge({u, w});
+            plain.removeEdge({u, w});
+        } else if ( !tracked.hasEdge(u, w) ) {
+            tracked.addEdge(u, w);
+            plain.addEdge(u, w);
+        }
+        if ( step % 500 == 499 ) {
+            tracked.removeVertex(u);
+            plain.removeVertex(u);
+            tracked.addVertex(u);
+            plain.addVertex(u);
+        }
+
+        // Assertions
+        ASSERT_EQ(plain.getNumComponents(), tracked.getNumComponents());
+        grapph::vertex_t a = rand() % 200;
+        grapph::vertex_t b = rand() % 200;
+        ASSERT_EQ(plain.connected(a, b), tracked.connected(a, b));
+    }
+}
@@ -1,68 +1,86 @@
 #include "Homomorphism.h"
+#include "Instrumentation.h"
 #include "SetFunctions.h"
 
+#include <algorithm>
 #include <sstream>
+#include <utility>
 
 namespace grapph {
 
-    void Homomorphism::validate() {
-        // Get vertex and edge sets
-        std::set<vertex_t> vertex_domain_expected = from.getVertices();
-        std::set<edge_t> edge_domain_expected = from.getEdges();
-        std::set<vertex_t> vertex_range_superset_expected = to.getVertices();
-        std::set<edge_t> edge_range_superset_expected = to.getEdges();
-
-        std::set<vertex_t> vertex_domain;
-        std::set<vertex_t> vertex_range;
-        std::set<edge_t> edge_domain;
-        std::set<edge_t> edge_range;
-
-        // Validate vertex mapping
-        for ( std::pair<vertex_t, vertex_t> mapping : vertex_map ) {
-            vertex_domain.insert(mapping.first);
-            vertex_range.insert(mapping.second);
+    Status Homomorphism::check(Graph& from, Graph& to, const vfunc_t& vertex_map) {
+        // View vertex and edge sets without copying them
+        const vset_t & vertex_domain_expected = from.viewVertices();
+        const eset_t & edge_domain_expected = from.viewEdges();
+
+        // Validate vertex mapping; both sides iterate in vertex order
+        bool same_domain = vertex_map.size() == vertex_domain_expected.size()
+                && std::equal(vertex_domain_expected.begin(), vertex_domain_expected.end(), vertex_map.begin(),
+                              [](vertex_t vertex, const std::pair<const vertex_t, vertex_t> & mapping) {
+                                  return vertex == mapping.first;
+                              });
+        if ( !same_domain )  return Status::VERTEX_NOT_MAPPED;
+        for ( const std::pair<const vertex_t, vertex_t> & mapping : vertex_map ) {
+            if ( !to.hasVertex(mapping.second) )  return Status::VERTEX_OUT_OF_RANGE;
         }
-        if ( !setEquals(vertex_domain_expected, vertex_domain) ) {
-            throw std::invalid_argument("Vertex homomorphism does not map every from-vertex");
+
+        // Validate edge mapping against the target directly
+        for ( const edge_t & edge : edge_domain_expected ) {
+            if ( !to.hasEdge(vertex_map.find(edge.first)->second, vertex_map.find(edge.second)->second) ) {
+                return Status::EDGE_OUT_OF_RANGE;
+            }
         }
-        if ( !setContains(vertex_range_superset_expected, vertex_range) ) {
-            throw std::invalid_argument("Vertex homomorphism maps to vertex not in to-vertices");
+
+        return Status::SUCCESS;
+    }
+
+    void Homomorphism::validate() {
+        GRAPPH_INSTRUMENT_SCOPE(Operation::HOMOMORPHISM_VALIDATE);
+
+        // Only build a message on failure
+        switch ( check(from, to, vertex_map) ) {
+            case Status::SUCCESS:
+                break;
+            case Status::VERTEX_NOT_MAPPED:
+                throw std::invalid_argument("Vertex homomorphism does not map every from-vertex");
+            case Status::VERTEX_OUT_OF_RANGE:
+                throw std::invalid_argument("Vertex homomorphism maps to vertex not in to-vertices");
+            default:
+                throw std::invalid_argument("Edge homomorphism maps to edge not in to-edges");
         }
 
-        // Construct edge mapping
-        for ( edge_t edge : from.getEdges() ) {
+        // Construct edge mapping; from-edges arrive sorted, so hint at the end
+        for ( const edge_t & edge : from.viewEdges() ) {
             edge_t mapped_edge = { vertex_map[edge.first], vertex_map[edge.second] };
             if ( mapped_edge.first > mapped_edge.second ) {
                 vertex_t temp = mapped_edge.first;
                 mapped_edge.first = mapped_edge.second;
                 mapped_edge.second = temp;
             }
-            edge_map[edge] = mapped_edge;
+            edge_map.emplace_hint(edge_map.end(), edge, mapped_edge);
         }
+    }
 
-        // Validate edge mapping
-        for ( std::pair<edge_t, edge_t> mapping : edge_map ) {
-            // First, ensure both edges ordered
-            if ( mapping.first.first > mapping.first.second ) {
-                mapping.first = { mapping.first.second, mapping.first.first };
-            }
-            if ( mapping.second.first > mapping.second.second ) {
-                mapping.second = { mapping.second.second, mapping.second.first };
-            }
-            edge_domain.insert(mapping.first);
-            edge_range.insert(mapping.second);
-        }
+    Status Homomorphism::tryMapVertex(vertex_t vertex, vertex_t& out) const {
+        auto it = vertex_map.find(vertex);
+        if ( it == vertex_map.end() )  return Status::VERTEX_NOT_FOUND;
 
-        if ( !setEquals(edge_domain_expected, edge_domain) ) {
-            throw std::invalid_argument("Edge homomorphism does not map every from-edge");
-        }
-        if ( !setContains(edge_range_superset_expected, edge_range) ) {
-            throw std::invalid_argument("Edge homomorphism maps to edge not in to-edges");
-        }
+        out = it->second;
+        return Status::SUCCESS;
+    }
+
+    Status Homomorphism::tryMapEdge(edge_t edge, edge_t& out) const {
+        if ( edge.first > edge.second )  edge = { edge.second, edge.first };
+
+        auto it = edge_map.find(edge);
+        if ( it == edge_map.end() )  return Status::EDGE_NOT_FOUND;
+
+        out = it->second;
+        return Status::SUCCESS;
     }
 
     Homomorphism::Homomorphism(Graph& from, Graph& to, vfunc_t vertex_map)
-            : from(from), to(to), vertex_map(vertex_map), edge_map() {
+            : from(from), to(to), vertex_map(std::move(vertex_map)), edge_map(this->vertex_map.get_allocator()) {
         validate();
     }
 
@@ -86,20 +104,18 @@ namespace grapph {
 
     bool Homomorphism::isSurjective() {
         // Assert every to-vertex in vertex range
-        std::set<vertex_t> vertex_range;
+        vset_t vertex_range;
         for ( std::pair<vertex_t, vertex_t> mapping : vertex_map ) {
             vertex_range.insert( mapping.second );
         }
-        std::set<vertex_t> expected_vertex_range = to.getVertices();
-        if ( !setEquals( vertex_range, expected_vertex_range ) )  return false;
+        if ( !setEquals( vertex_range, to.viewVertices() ) )  return false;
 
         // Assert every to-edge in edge range
-        std::set<edge_t> edge_range;
+        eset_t edge_range;
         for ( std::pair<edge_t, edge_t> mapping : edge_map ) {
             edge_range.insert( mapping.second );
         }
-        std::set<edge_t> expected_edge_range = to.getEdges();
-        if ( !setEquals( edge_range, expected_edge_range ) )  return false;
+        if ( !setEquals( edge_range, to.viewEdges() ) )  return false;
 
         return true;
     }
@@ -109,20 +125,37 @@ namespace grapph {
     }
 
     Homomorphism Homomorphism::compose(Homomorphism first, Homomorphism second) {
-        // Ensure homomorphisms can be composed
-        if ( !first.to.equals(second.from) ) {
+        // Ensure homomorphisms can be composed; the same graph object needs no
+        // comparison, and different ones usually differ in fingerprint
+        if ( &first.to != &second.from && !first.to.equals(second.from) ) {
             throw std::invalid_argument("Cannot compose homomorphisms of different graphs -- check order");
         }
-        // Compose vertex homomorphisms
-        vfunc_t vertex_map_composition;
-        for ( std::pair<vertex_t, vertex_t> mapping : first.getVertexMap() ) {
-            vertex_map_composition[mapping.first] = second.getVertexMap()[mapping.second];
+        // Compose vertex homomorphisms; read the maps in place, since the
+        // getters copy, and keys arrive sorted so hint at the end
+        vfunc_t vertex_map_composition(first.vertex_map.get_allocator());
+        for ( const std::pair<const vertex_t, vertex_t> & mapping : first.vertex_map ) {
+            vertex_map_composition.emplace_hint(vertex_map_composition.end(), mapping.first,
+                                                second.vertex_map.at(mapping.second));
         }
 
         // Create and return composed homomorphism
         Homomorphism composed = Homomorphism(first.getFromGraph(), second.getToGraph(),
-                                             vertex_map_composition);
+                                             std::move(vertex_map_composition));
         return composed;
     }
 
-}
\ No newline at end of file
+    Homomorphism Homomorphism::induce(Graph& graph, std::set<vertex_t>& vertex_subset, Graph& induced,
+                                      size_t threads) {
+        induced = graph.induce(vertex_subset, threads, true, induced.getResource());
+
+        // Vertex i of the induced graph is the i-th smallest vertex of the subset
+        vfunc_t vertex_map(induced.getResource());
+        vertex_t label = 0;
+        for ( vertex_t vertex : vertex_subset ) {
+            vertex_map.emplace_hint(vertex_map.end(), label++, vertex);
+        }
+
+        return Homomorphism(induced, graph, std::move(vertex_map));
+    }
+
+}
@@ -0,0 +1,49 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "Homomorphism.h"
+
+// Rotation u -> u + shift mod n of a cycle onto itself
+static grapph::Graph cycle(size_t n) {
+    std::set<grapph::vertex_t> vertices;
+    std::set<grapph::edge_t> edges;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) {
+        vertices.insert(u);
+        edges.insert({ std::min(u, (u + 1) % n), std::max(u, (u + 1) % n) });
+    }
+    return grapph::Graph(vertices, edges);
+}
+
+static grapph::vfunc_t rotation(size_t n, size_t shift) {
+    grapph::vfunc_t vertex_map;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertex_map.emplace_hint(vertex_map.end(), u, (u + shift) % n); }
+    return vertex_map;
+}
+
+static void BM_HomomorphismCompose(benchmark::State & state) {
+    grapph::Graph graph = cycle(state.range(0));
+    grapph::Homomorphism first(graph, graph, rotation(state.range(0), 1));
+    grapph::Homomorphism second(graph, graph, rotation(state.range(0), 2));
+
+    for ( auto _ : state ) {
+        grapph::Homomorphism composed = grapph::Homomorphism::compose(first, second);
+        benchmark::DoNotOptimize(&composed);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HomomorphismCompose)->Arg(1 << 10)->Arg(1 << 14)->Unit(benchmark::kMillisecond);
+
+// Induce half of a random graph and build the embedding back into it
+static void BM_HomomorphismInduce(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> subset;
+    for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u += 2 ) { subset.insert(u); }
+
+    for ( auto _ : state ) {
+        grapph::Graph induced;
+        grapph::Homomorphism embedding = grapph::Homomorphism::induce(graph, subset, induced);
+        benchmark::DoNotOptimize(&embedding);
+    }
+    state.SetItemsProcessed(state.iterations() * subset.size());
+}
+BENCHMARK(BM_HomomorphismInduce)->ArgsProduct({ { 1 << 10, 1 << 14 }, { 4, 32 } })->Unit(benchmark::kMillisecond);
@@ -2,6 +2,7 @@
 
 #include "Graph.h"
 #include "Homomorphism.h"
+#include "SetFunctions.h"
 
 TEST(HomomorphismTest, Homomorphism1) {
     // First, create two graphs
@@ -125,4 +126,55 @@ TEST(HomomorphismTest, HomomorphismComposition2) {
 
     // Compose homomorphisms
     ASSERT_THROW(grapph::Homomorphism::compose(h2p, p2t), std::invalid_argument);
-}
\ No newline at end of file
+}
+
+TEST(HomomorphismTest, HomomorphismCheck) {
+    // First, create two graphs
+    grapph::Graph pentagon({ 0, 1, 2, 3, 4 }, { { 0, 1 }, { 1, 2 }, { 2, 3 },
+                                                { 3, 4 }, { 4, 0 } });
+    grapph::Graph triangle({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 2, 0 } });
+
+    // Check candidate maps without constructing homomorphisms
+    ASSERT_EQ(grapph::Status::SUCCESS, grapph::Homomorphism::check(pentagon, triangle,
+              { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 4, 2 } }));
+    ASSERT_EQ(grapph::Status::EDGE_OUT_OF_RANGE, grapph::Homomorphism::check(pentagon, triangle,
+              { { 0, 0 }, { 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 1 } }));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_MAPPED, grapph::Homomorphism::check(pentagon, triangle,
+              { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 } }));
+    ASSERT_EQ(grapph::Status::VERTEX_OUT_OF_RANGE, grapph::Homomorphism::check(pentagon, triangle,
+              { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 4, 5 } }));
+
+    // Look up mapped vertices and edges
+    grapph::Homomorphism hmm(pentagon, triangle, { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 4, 2 } });
+    grapph::vertex_t vertex;
+    grapph::edge_t edge;
+    ASSERT_EQ(grapph::Status::SUCCESS, hmm.tryMapVertex(4, vertex));
+    ASSERT_EQ(2, vertex);
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_FOUND, hmm.tryMapVertex(5, vertex));
+    ASSERT_EQ(grapph::Status::SUCCESS, hmm.tryMapEdge({ 4, 3 }, edge));
+    ASSERT_EQ(grapph::edge_t(0, 2), edge);
+    ASSERT_EQ(grapph::Status::EDGE_NOT_FOUND, hmm.tryMapEdge({ 0, 2 }, edge));
+}
+
+TEST(HomomorphismTest, HomomorphismInduce) {
+    // Initialize pentagon with tails and gaps in its vertex ids
+    grapph::Graph graph({ 0, 2, 4, 6, 8, 10, 12 }, { { 0, 2 }, { 2, 4 }, { 4, 6 }, { 6, 8 },
+                                                     { 8, 0 }, { 6, 10 }, { 8, 12 } });
+
+    // Induce and embed
+    std::set<grapph::vertex_t> subset = { 4, 6, 8, 12 };
+    grapph::Graph induced;
+    grapph::Homomorphism embedding = grapph::Homomorphism::induce(graph, subset, induced);
+
+    // Assertions
+    std::set<grapph::vertex_t> expected_vertices = { 0, 1, 2, 3 };
+    std::set<grapph::edge_t> expected_edges = { { 0, 1 }, { 1, 2 }, { 2, 3 } };
+    ASSERT_TRUE(grapph::setEquals(expected_vertices, induced.getVertices()));
+    ASSERT_TRUE(grapph::setEquals(expected_edges, induced.getEdges()));
+    ASSERT_TRUE(embedding.isInjective());
+    ASSERT_FALSE(embedding.isSurjective());
+    ASSERT_EQ(12, embedding.getVertexMap()[3]);
+    grapph::edge_t edge;
+    ASSERT_EQ(grapph::Status::SUCCESS, embedding.tryMapEdge({ 2, 3 }, edge));
+    ASSERT_EQ(grapph::edge_t(8, 12), edge);
+}
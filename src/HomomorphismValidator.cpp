@@ -0,0 +1,70 @@
+#include "HomomorphismValidator.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+
+namespace grapph {
+
+    HomomorphismValidator::HomomorphismValidator(Graph& from, Graph& to, size_t threads)
+            : from(from), to(to), threads(threads),
+              from_index(from.viewVertices().begin(), from.viewVertices().end()) {
+        // Flatten from-edges once; every check walks this list
+        edge_positions.reserve(from.viewEdges().size());
+        for ( const edge_t & edge : from.viewEdges() ) {
+            edge_positions.push_back({ from_index.indexOf(edge.first), from_index.indexOf(edge.second) });
+        }
+        image.reserve(from_index.size());
+    }
+
+    Status HomomorphismValidator::check(const vfunc_t& vertex_map) {
+        // Map keys and from-vertices are both sorted, so compare them in lockstep
+        if ( vertex_map.size() != from_index.size() )  return Status::VERTEX_NOT_MAPPED;
+
+        image.clear();
+        size_t position = 0;
+        for ( const std::pair<const vertex_t, vertex_t> & mapping : vertex_map ) {
+            if ( mapping.first != from_index.idOf(position++) )  return Status::VERTEX_NOT_MAPPED;
+            image.push_back(mapping.second);
+        }
+
+        return check(image);
+    }
+
+    Status HomomorphismValidator::check(const std::vector<vertex_t>& image) const {
+        if ( image.size() != from_index.size() )  return Status::VERTEX_NOT_MAPPED;
+
+        for ( vertex_t vertex : image ) {
+            if ( !to.hasVertex(vertex) )  return Status::VERTEX_OUT_OF_RANGE;
+        }
+
+        return checkEdges(image);
+    }
+
+    Status HomomorphismValidator::checkEdges(const std::vector<vertex_t>& image) const {
+        size_t workers = edge_positions.size() < PARALLEL_EDGE_THRESHOLD ? 1 : threads;
+        if ( resolveThreads(workers) <= 1 ) {
+            for ( const std::pair<size_t, size_t> & edge : edge_positions ) {
+                if ( !to.hasEdge(image[edge.first], image[edge.second]) )  return Status::EDGE_OUT_OF_RANGE;
+            }
+            return Status::SUCCESS;
+        }
+
+        // Workers poll a shared flag so one violation stops all of them
+        std::atomic<bool> violated(false);
+        parallelFor(0, edge_positions.size(), workers, [&](size_t lo, size_t hi, size_t) {
+            for ( size_t i = lo; i < hi; i++ ) {
+                if ( (i & 255) == 0 && violated.load(std::memory_order_relaxed) )  return;
+
+                const std::pair<size_t, size_t> & edge = edge_positions[i];
+                if ( !to.hasEdge(image[edge.first], image[edge.second]) ) {
+                    violated.store(true, std::memory_order_relaxed);
+                    return;
+                }
+            }
+        });
+
+        return violated.load() ? Status::EDGE_OUT_OF_RANGE : Status::SUCCESS;
+    }
+
+}
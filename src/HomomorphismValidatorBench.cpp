@@ -0,0 +1,47 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "HomomorphismValidator.h"
+
+// Identity map of a random graph onto itself, so every edge has to be checked
+static grapph::vfunc_t identityMap(grapph::Graph & graph) {
+    grapph::vfunc_t vertex_map;
+    for ( grapph::vertex_t u : graph.viewVertices() ) { vertex_map.emplace_hint(vertex_map.end(), u, u); }
+
+    return vertex_map;
+}
+
+static void BM_HomomorphismConstructor(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::vfunc_t vertex_map = identityMap(graph);
+
+    for ( auto _ : state ) {
+        grapph::Homomorphism hmm(graph, graph, vertex_map);
+        benchmark::DoNotOptimize(&hmm);
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_HomomorphismConstructor)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_HomomorphismCheck(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::vfunc_t vertex_map = identityMap(graph);
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::Homomorphism::check(graph, graph, vertex_map));
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_HomomorphismCheck)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_HomomorphismValidator(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::HomomorphismValidator validator(graph, graph, state.range(2));
+    std::vector<grapph::vertex_t> image(graph.viewVertices().begin(), graph.viewVertices().end());
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(validator.check(image));
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_HomomorphismValidator)->Args({1 << 14, 16, 1})->Args({1 << 14, 16, 0})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,64 @@
+#include "gtest/gtest.h"
+
+#include "Graph.h"
+#include "HomomorphismValidator.h"
+
+TEST(HomomorphismValidatorTest, CheckMaps) {
+    // Pentagon onto triangle, as in HomomorphismTest
+    grapph::Graph pentagon({ 0, 1, 2, 3, 4 }, { { 0, 1 }, { 1, 2 }, { 2, 3 },
+                                                { 3, 4 }, { 4, 0 } });
+    grapph::Graph triangle({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 2, 0 } });
+    grapph::HomomorphismValidator validator(pentagon, triangle);
+
+    // Same answers as Homomorphism::check
+    grapph::vfunc_t valid = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 4, 2 } };
+    grapph::vfunc_t bad_edge = { { 0, 0 }, { 1, 0 }, { 2, 1 }, { 3, 2 }, { 4, 1 } };
+    grapph::vfunc_t bad_domain = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 5, 2 } };
+    grapph::vfunc_t bad_range = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { 3, 0 }, { 4, 5 } };
+
+    ASSERT_EQ(grapph::Status::SUCCESS, validator.check(valid));
+    ASSERT_EQ(grapph::Status::EDGE_OUT_OF_RANGE, validator.check(bad_edge));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_MAPPED, validator.check(bad_domain));
+    ASSERT_EQ(grapph::Status::VERTEX_OUT_OF_RANGE, validator.check(bad_range));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_MAPPED, validator.check(grapph::vfunc_t()));
+    ASSERT_TRUE(validator.isValid(valid));
+    for ( const grapph::vfunc_t & vertex_map : { valid, bad_edge, bad_domain, bad_range } ) {
+        ASSERT_EQ(grapph::Homomorphism::check(pentagon, triangle, vertex_map), validator.check(vertex_map));
+    }
+}
+
+TEST(HomomorphismValidatorTest, CheckDenseMaps) {
+    // From-graph with gaps in its vertex ids
+    grapph::Graph path({ 3, 7, 10 }, { { 3, 7 }, { 7, 10 } });
+    grapph::Graph edge({ 0, 1 }, { { 0, 1 } });
+    grapph::HomomorphismValidator validator(path, edge);
+
+    // Images are given by from-vertex position
+    ASSERT_TRUE(validator.isValid(std::vector<grapph::vertex_t>({ 0, 1, 0 })));
+    ASSERT_FALSE(validator.isValid(std::vector<grapph::vertex_t>({ 0, 0, 1 })));
+    ASSERT_EQ(grapph::Status::VERTEX_NOT_MAPPED, validator.check(std::vector<grapph::vertex_t>({ 0, 1 })));
+    ASSERT_EQ(grapph::Status::VERTEX_OUT_OF_RANGE, validator.check(std::vector<grapph::vertex_t>({ 0, 1, 2 })));
+    ASSERT_EQ(7, validator.getFromIndex().idOf(1));
+}
+
+TEST(HomomorphismValidatorTest, CheckParallel) {
+    // Large even cycle maps onto an edge by parity
+    size_t n = 2 * grapph::HomomorphismValidator::PARALLEL_EDGE_THRESHOLD;
+    grapph::Graph cycle;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { cycle.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { cycle.addEdge(u, (u + 1) % n); }
+    grapph::Graph edge({ 0, 1 }, { { 0, 1 } });
+
+    grapph::HomomorphismValidator serial(cycle, edge);
+    grapph::HomomorphismValidator parallel(cycle, edge, 4);
+
+    std::vector<grapph::vertex_t> image(n);
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { image[u] = u % 2; }
+    ASSERT_TRUE(serial.isValid(image));
+    ASSERT_TRUE(parallel.isValid(image));
+
+    // Break a single edge late in the list
+    image[n - 10] = image[n - 11];
+    ASSERT_EQ(grapph::Status::EDGE_OUT_OF_RANGE, serial.check(image));
+    ASSERT_EQ(grapph::Status::EDGE_OUT_OF_RANGE, parallel.check(image));
+}
@@ -0,0 +1,221 @@
+#include "Instrumentation.h"
+
+#include <atomic>
+#include <fstream>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace grapph {
+
+    namespace {
+
+        const char * OPERATION_NAMES[NUM_OPERATIONS] = {
+                "addVertex", "removeVertex", "addEdge", "removeEdge", "hasVertex", "hasEdge",
+                "adjacent", "getNeighbors", "induce", "equals", "Homomorphism::validate"
+        };
+
+        struct AtomicStats {
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> exceptions{0};
+            std::atomic<uint64_t> total_nanos{0};
+            std::atomic<uint64_t> max_nanos{0};
+            std::atomic<uint64_t> histogram[OperationStats::NUM_BUCKETS] = {};
+        };
+
+        AtomicStats stats[NUM_OPERATIONS];
+        std::atomic<uint64_t> validation_failures{0};
+
+        size_t bucket(uint64_t nanos) {
+            if ( nanos == 0 ) { return 0; }
+            size_t log = 63 - __builtin_clzll(nanos);
+            return log < OperationStats::NUM_BUCKETS ? log : OperationStats::NUM_BUCKETS - 1;
+        }
+
+        // One complete event ("ph": "X") of the Chrome trace format
+        struct TraceEvent {
+            Operation operation;
+            uint64_t start_nanos;
+            uint64_t nanos;
+            size_t thread;
+        };
+
+        std::atomic<uint64_t> trace_threshold{UINT64_MAX};
+        std::mutex trace_mutex;
+        std::vector<TraceEvent> trace_events;
+
+        // Trace timestamps count from the first recorded call
+        const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+        // Small, stable per-thread ids read better in trace viewers than hashes
+        size_t threadId() {
+            static std::atomic<size_t> next_thread{0};
+            thread_local size_t id = next_thread++;
+            return id;
+        }
+
+        // Forwards to the resource it replaced as default, counting as it goes
+        class CountingResource : public std::pmr::memory_resource {
+
+        public:
+
+            std::pmr::memory_resource * upstream = nullptr;
+
+            std::atomic<uint64_t> allocations{0};
+            std::atomic<uint64_t> bytes_allocated{0};
+            std::atomic<uint64_t> bytes_deallocated{0};
+
+        private:
+
+            void * do_allocate(size_t bytes, size_t alignment) override {
+                allocations.fetch_add(1, std::memory_order_relaxed);
+                bytes_allocated.fetch_add(bytes, std::memory_order_relaxed);
+                return upstream->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void * p, size_t bytes, size_t alignment) override {
+                bytes_deallocated.fetch_add(bytes, std::memory_order_relaxed);
+                upstream->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+                return this == &other;
+            }
+
+        };
+
+        CountingResource counting_resource;
+
+    }
+
+    const char* operationName(Operation operation) {
+        return OPERATION_NAMES[static_cast<size_t>(operation)];
+    }
+
+    uint64_t OperationStats::percentileNanos(double q) const {
+        if ( calls == 0 ) { return 0; }
+
+        // Smallest bucket whose running count reaches the quantile's rank
+        uint64_t rank = q <= 0 ? 1 : static_cast<uint64_t>(q * calls + 0.5);
+        if ( rank == 0 ) { rank = 1; }
+        uint64_t seen = 0;
+        for ( size_t i = 0; i < NUM_BUCKETS; i++ ) {
+            seen += histogram[i];
+            if ( seen >= rank ) { return i + 1 < NUM_BUCKETS ? (uint64_t(2) << i) - 1 : max_nanos; }
+        }
+        return max_nanos;
+    }
+
+    InstrumentationSnapshot Instrumentation::snapshot() {
+        InstrumentationSnapshot snapshot;
+        for ( size_t op = 0; op < NUM_OPERATIONS; op++ ) {
+            OperationStats & out = snapshot.operations[op];
+            out.calls = stats[op].calls.load(std::memory_order_relaxed);
+            out.exceptions = stats[op].exceptions.load(std::memory_order_relaxed);
+            out.total_nanos = stats[op].total_nanos.load(std::memory_order_relaxed);
+            out.max_nanos = stats[op].max_nanos.load(std::memory_order_relaxed);
+            for ( size_t i = 0; i < OperationStats::NUM_BUCKETS; i++ ) {
+                out.histogram[i] = stats[op].histogram[i].load(std::memory_order_relaxed);
+            }
+        }
+        snapshot.allocations = counting_resource.allocations.load(std::memory_order_relaxed);
+        snapshot.bytes_allocated = counting_resource.bytes_allocated.load(std::memory_order_relaxed);
+        snapshot.bytes_deallocated = counting_resource.bytes_deallocated.load(std::memory_order_relaxed);
+        snapshot.validation_failures = validation_failures.load(std::memory_order_relaxed);
+
+        return snapshot;
+    }
+
+    void Instrumentation::reset() {
+        for ( AtomicStats & op : stats ) {
+            op.calls = 0;
+            op.exceptions = 0;
+            op.total_nanos = 0;
+            op.max_nanos = 0;
+            for ( std::atomic<uint64_t> & count : op.histogram ) { count = 0; }
+        }
+        counting_resource.allocations = 0;
+        counting_resource.bytes_allocated = 0;
+        counting_resource.bytes_deallocated = 0;
+        validation_failures = 0;
+
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        trace_events.clear();
+    }
+
+    void Instrumentation::countAllocations(bool enable) {
+        if ( !enabled ) { return; }
+
+        bool installed = std::pmr::get_default_resource() == &counting_resource;
+        if ( enable && !installed ) {
+            counting_resource.upstream = std::pmr::set_default_resource(&counting_resource);
+        } else if ( !enable && installed ) {
+            std::pmr::set_default_resource(counting_resource.upstream);
+        }
+    }
+
+    void Instrumentation::traceSlowerThan(uint64_t nanos) {
+        trace_threshold.store(nanos, std::memory_order_relaxed);
+    }
+
+    size_t Instrumentation::getNumTraceEvents() {
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        return trace_events.size();
+    }
+
+    void Instrumentation::writeTrace(const std::string & path) {
+        std::ofstream out(path);
+        if ( !out ) {
+            std::stringstream ss;
+            ss << "Cannot write trace to " << path;
+            throw std::invalid_argument(ss.str());
+        }
+
+        // Timestamps and durations are in microseconds
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        out << "{\"traceEvents\":[";
+        for ( size_t i = 0; i < trace_events.size(); i++ ) {
+            const TraceEvent & event = trace_events[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "{\"name\":\"" << operationName(event.operation) << "\",\"cat\":\"grapph\",\"ph\":\"X\""
+                << ",\"ts\":" << event.start_nanos / 1000 << '.' << event.start_nanos % 1000 / 100
+                << ",\"dur\":" << event.nanos / 1000 << '.' << event.nanos % 1000 / 100
+                << ",\"pid\":0,\"tid\":" << event.thread << "}";
+        }
+        out << "\n],\"displayTimeUnit\":\"ns\"}\n";
+
+        if ( !out ) {
+            std::stringstream ss;
+            ss << "Cannot write trace to " << path;
+            throw std::invalid_argument(ss.str());
+        }
+    }
+
+    void Instrumentation::record(Operation operation, std::chrono::steady_clock::time_point start, uint64_t nanos,
+                                 bool threw) {
+        AtomicStats & op = stats[static_cast<size_t>(operation)];
+        op.calls.fetch_add(1, std::memory_order_relaxed);
+        if ( threw ) { op.exceptions.fetch_add(1, std::memory_order_relaxed); }
+        op.total_nanos.fetch_add(nanos, std::memory_order_relaxed);
+        op.histogram[bucket(nanos)].fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t max = op.max_nanos.load(std::memory_order_relaxed);
+        while ( nanos > max && !op.max_nanos.compare_exchange_weak(max, nanos, std::memory_order_relaxed) ) {}
+
+        if ( nanos < trace_threshold.load(std::memory_order_relaxed) ) { return; }
+
+        uint64_t start_nanos = start < epoch ? 0 : std::chrono::duration_cast<std::chrono::nanoseconds>(
+                start - epoch).count();
+        std::lock_guard<std::mutex> lock(trace_mutex);
+        if ( trace_events.size() < MAX_TRACE_EVENTS ) {
+            trace_events.push_back({ operation, start_nanos, nanos, threadId() });
+        }
+    }
+
+    void Instrumentation::recordValidationFailure() {
+        validation_failures.fetch_add(1, std::memory_order_relaxed);
+    }
+
+}
@@ -0,0 +1,200 @@
+#include "gtest/gtest.h"
+
+#include "FeatureGraph.h"
+#include "Homomorphism.h"
+#include "Instrumentation.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+TEST(InstrumentationTest, TestCountsCalls) {
+    grapph::Instrumentation::reset();
+    ASSERT_TRUE(grapph::Instrumentation::enabled);
+
+    grapph::Graph graph;
+    graph.addVertex(1);
+    graph.addVertex(2);
+    graph.addVertex();
+    graph.addEdge(2, 1);
+    graph.hasVertex(3);
+    graph.hasEdge(1, 2);
+    graph.adjacent(1, 2);
+    graph.getNeighbors(1);
+    graph.removeEdge({ 1, 2 });
+    graph.removeVertex(3);
+
+    // Assertions; delegating overloads count once
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(3, snapshot[grapph::Operation::ADD_VERTEX].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADD_EDGE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::HAS_VERTEX].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::HAS_EDGE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADJACENT].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::GET_NEIGHBORS].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::REMOVE_EDGE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::REMOVE_VERTEX].calls);
+    ASSERT_EQ(0, snapshot[grapph::Operation::ADD_VERTEX].exceptions);
+
+    // Every call lands in exactly one bucket
+    const grapph::OperationStats & adds = snapshot[grapph::Operation::ADD_VERTEX];
+    uint64_t bucketed = 0;
+    for ( uint64_t count : adds.histogram ) { bucketed += count; }
+    ASSERT_EQ(3, bucketed);
+    ASSERT_LE(adds.max_nanos, adds.total_nanos);
+    ASSERT_LE(adds.meanNanos(), double(adds.max_nanos));
+
+    grapph::Instrumentation::reset();
+    ASSERT_EQ(0, grapph::Instrumentation::snapshot()[grapph::Operation::ADD_VERTEX].calls);
+}
+
+TEST(InstrumentationTest, TestCountsExceptions) {
+    grapph::Graph graph({ 1, 2 }, { {1, 2} });
+    grapph::Instrumentation::reset();
+
+    ASSERT_THROW(graph.addVertex(1), std::invalid_argument);
+    ASSERT_THROW(graph.adjacent(1, 5), std::invalid_argument);
+    ASSERT_THROW(graph.getNeighbors(5), std::invalid_argument);
+    ASSERT_THROW(graph.addEdge(1, 2), std::invalid_argument);
+    graph.adjacent(1, 2);
+
+    // Assertions
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADD_VERTEX].exceptions);
+    ASSERT_EQ(2, snapshot[grapph::Operation::ADJACENT].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADJACENT].exceptions);
+    ASSERT_EQ(1, snapshot[grapph::Operation::GET_NEIGHBORS].exceptions);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADD_EDGE].exceptions);
+    // Validation inside a call is not a query of its own
+    ASSERT_EQ(0, snapshot[grapph::Operation::HAS_VERTEX].calls);
+}
+
+TEST(InstrumentationTest, TestCountsValidationFailures) {
+    grapph::FeatureGraph<int, int> graph({ {1, 10}, {2, 20} }, { {{1, 2}, 12} });
+    grapph::Instrumentation::reset();
+
+    // None of these have a timer of their own
+    ASSERT_THROW(graph.getDegree(5), std::invalid_argument);
+    ASSERT_THROW(graph.viewNeighbors(5), std::invalid_argument);
+    ASSERT_THROW(graph.incident(5, { 1, 2 }), std::invalid_argument);
+    ASSERT_THROW(graph.getVertexState(5), std::invalid_argument);
+    ASSERT_THROW(graph.getEdgeState({ 1, 1 }), std::invalid_argument);
+    graph.getDegree(1);
+
+    // Assertions; a failed timed call counts in both places
+    ASSERT_EQ(5, grapph::Instrumentation::snapshot().validation_failures);
+    ASSERT_THROW(graph.adjacent(1, 5), std::invalid_argument);
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(6, snapshot.validation_failures);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADJACENT].exceptions);
+
+    grapph::Instrumentation::reset();
+    ASSERT_EQ(0, grapph::Instrumentation::snapshot().validation_failures);
+}
+
+TEST(InstrumentationTest, TestInduceAndHomomorphism) {
+    grapph::Graph graph({ 1, 2, 3, 4 }, { {1, 2}, {2, 3}, {3, 4} });
+    std::set<grapph::vertex_t> subset = { 1, 2, 3 };
+    grapph::Instrumentation::reset();
+
+    grapph::Graph induced;
+    grapph::Homomorphism embedding = grapph::Homomorphism::induce(graph, subset, induced);
+    ASSERT_TRUE(graph.equals(graph));
+
+    grapph::vfunc_t bad;
+    bad[1] = 1;
+    ASSERT_THROW(grapph::Homomorphism(graph, graph, bad), std::invalid_argument);
+
+    // Assertions
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(1, snapshot[grapph::Operation::INDUCE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::EQUALS].calls);
+    ASSERT_EQ(2, snapshot[grapph::Operation::HOMOMORPHISM_VALIDATE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::HOMOMORPHISM_VALIDATE].exceptions);
+    // The embedding checks each edge against the original graph
+    ASSERT_EQ(2, snapshot[grapph::Operation::HAS_EDGE].calls);
+}
+
+TEST(InstrumentationTest, TestFeatureGraphMutations) {
+    grapph::FeatureGraph<int, int> graph;
+    grapph::Instrumentation::reset();
+
+    graph.addVertex(1, 10);
+    graph.addVertex(2, 20);
+    graph.addEdge({ 1, 2 }, 12);
+    ASSERT_THROW(graph.addVertex(1, 30), std::invalid_argument);
+    graph.removeEdge({ 1, 2 });
+
+    // Assertions
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(3, snapshot[grapph::Operation::ADD_VERTEX].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADD_VERTEX].exceptions);
+    ASSERT_EQ(1, snapshot[grapph::Operation::ADD_EDGE].calls);
+    ASSERT_EQ(1, snapshot[grapph::Operation::REMOVE_EDGE].calls);
+}
+
+TEST(InstrumentationTest, TestCountsAllocations) {
+    grapph::Instrumentation::reset();
+    grapph::Instrumentation::countAllocations();
+    {
+        grapph::Graph graph;
+        for ( grapph::vertex_t u = 0; u < 100; u++ ) { graph.addVertex(u); }
+
+        grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+        ASSERT_LE(100, snapshot.allocations);
+        ASSERT_LE(100 * sizeof(grapph::vertex_t), snapshot.bytes_allocated);
+    }
+    grapph::Instrumentation::countAllocations(false);
+
+    // Everything allocated was given back
+    grapph::InstrumentationSnapshot snapshot = grapph::Instrumentation::snapshot();
+    ASSERT_EQ(snapshot.bytes_allocated, snapshot.bytes_deallocated);
+    ASSERT_EQ(std::pmr::new_delete_resource(), std::pmr::get_default_resource());
+}
+
+TEST(InstrumentationTest, TestPercentiles) {
+    grapph::OperationStats stats;
+    ASSERT_EQ(0, stats.percentileNanos(0.5));
+
+    // 90 calls around 100ns and 10 around 10us
+    stats.calls = 100;
+    stats.histogram[6] = 90;
+    stats.histogram[13] = 10;
+    stats.max_nanos = 12000;
+    ASSERT_EQ(127, stats.percentileNanos(0.5));
+    ASSERT_EQ(127, stats.percentileNanos(0.9));
+    ASSERT_EQ(16383, stats.percentileNanos(0.99));
+    ASSERT_EQ(127, stats.percentileNanos(0.0));
+}
+
+TEST(InstrumentationTest, TestTraceExport) {
+    grapph::Instrumentation::reset();
+
+    // Only calls at or above the threshold are kept
+    grapph::Instrumentation::traceSlowerThan(0);
+    grapph::Graph graph({ 1, 2, 3 }, { {1, 2} });
+    std::set<grapph::vertex_t> subset = { 1, 2 };
+    graph.induce(subset);
+    graph.hasVertex(1);
+    grapph::Instrumentation::traceSlowerThan(UINT64_MAX);
+    graph.hasVertex(2);
+    ASSERT_EQ(2, grapph::Instrumentation::getNumTraceEvents());
+
+    std::string path = ::testing::TempDir() + "grapph_trace.json";
+    grapph::Instrumentation::writeTrace(path);
+    std::ifstream in(path);
+    std::stringstream contents;
+    contents << in.rdbuf();
+    std::string json = contents.str();
+    std::remove(path.c_str());
+
+    // Assertions
+    ASSERT_EQ(0, json.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"induce\""));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"hasVertex\""));
+    ASSERT_NE(std::string::npos, json.find("\"ph\":\"X\""));
+    ASSERT_THROW(grapph::Instrumentation::writeTrace("/nonexistent/dir/trace.json"), std::invalid_argument);
+
+    grapph::Instrumentation::reset();
+    ASSERT_EQ(0, grapph::Instrumentation::getNumTraceEvents());
+}
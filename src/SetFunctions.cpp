@@ -0,0 +1,290 @@
+#include "SetFunctions.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define GRAPPH_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace grapph {
+
+    namespace {
+
+        // Past this size ratio the smaller array is galloped through the
+        // larger one instead of merged with it
+        const size_t GALLOP_RATIO = 32;
+
+        // First position in [lo, n) holding a value >= target, searching
+        // outward from lo in doubling steps
+        size_t gallop(const vertex_t * data, size_t lo, size_t n, vertex_t target) {
+            size_t step = 1;
+            size_t hi = lo;
+            while ( hi < n && data[hi] < target ) {
+                lo = hi + 1;
+                hi += step;
+                step <<= 1;
+            }
+
+            return std::lower_bound(data + lo, data + std::min(hi, n), target) - data;
+        }
+
+        template <bool Write>
+        size_t intersectScalar(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            if ( na > nb ) {
+                std::swap(a, b);
+                std::swap(na, nb);
+            }
+
+            size_t k = 0;
+            if ( na * GALLOP_RATIO < nb ) {
+                size_t j = 0;
+                for ( size_t i = 0; i < na && j < nb; i++ ) {
+                    j = gallop(b, j, nb, a[i]);
+                    if ( j < nb && b[j] == a[i] ) {
+                        if ( Write ) { out[k] = a[i]; }
+                        k++;
+                    }
+                }
+                return k;
+            }
+
+            // Advance both cursors without a data-dependent branch
+            size_t i = 0;
+            size_t j = 0;
+            while ( i < na && j < nb ) {
+                vertex_t x = a[i];
+                vertex_t y = b[j];
+                if ( Write ) { out[k] = x; }
+                k += x == y;
+                i += x <= y;
+                j += y <= x;
+            }
+
+            return k;
+        }
+
+        size_t unionScalar(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            size_t i = 0;
+            size_t j = 0;
+            size_t k = 0;
+            while ( i < na && j < nb ) {
+                vertex_t x = a[i];
+                vertex_t y = b[j];
+                out[k++] = x <= y ? x : y;
+                i += x <= y;
+                j += y <= x;
+            }
+            std::copy(a + i, a + na, out + k);
+            k += na - i;
+            std::copy(b + j, b + nb, out + k);
+
+            return k + nb - j;
+        }
+
+#ifdef GRAPPH_X86_SIMD
+
+        // Block intersections compare a block of a against every rotation of
+        // a block of b, then advance whichever block ends lower (both when
+        // they end equal). Inputs are duplicate free, so every common value
+        // matches exactly once and matches come out in a's order.
+
+        template <bool Write>
+        __attribute__((target("sse4.1")))
+        size_t intersectSse41(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            size_t i = 0;
+            size_t j = 0;
+            size_t k = 0;
+            while ( i + 2 <= na && j + 2 <= nb ) {
+                __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+                __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+                __m128i match = _mm_or_si128(_mm_cmpeq_epi64(va, vb),
+                                             _mm_cmpeq_epi64(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+                int mask = _mm_movemask_pd(_mm_castsi128_pd(match));
+                if ( Write ) {
+                    if ( mask & 1 ) { out[k++] = a[i]; }
+                    if ( mask & 2 ) { out[k++] = a[i + 1]; }
+                } else {
+                    k += __builtin_popcount(mask);
+                }
+
+                vertex_t a_last = a[i + 1];
+                vertex_t b_last = b[j + 1];
+                i += a_last <= b_last ? 2 : 0;
+                j += b_last <= a_last ? 2 : 0;
+            }
+
+            return k + intersectScalar<Write>(a + i, na - i, b + j, nb - j, out + k);
+        }
+
+        template <bool Write>
+        __attribute__((target("avx2")))
+        size_t intersectAvx2(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            size_t i = 0;
+            size_t j = 0;
+            size_t k = 0;
+            while ( i + 4 <= na && j + 4 <= nb ) {
+                __m256i va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+                __m256i vb = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j));
+                __m256i match = _mm256_or_si256(
+                        _mm256_or_si256(_mm256_cmpeq_epi64(va, vb),
+                                        _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(0, 3, 2, 1)))),
+                        _mm256_or_si256(_mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(1, 0, 3, 2))),
+                                        _mm256_cmpeq_epi64(va, _mm256_permute4x64_epi64(vb, _MM_SHUFFLE(2, 1, 0, 3)))));
+                unsigned mask = _mm256_movemask_pd(_mm256_castsi256_pd(match));
+                if ( Write ) {
+                    while ( mask != 0 ) {
+                        out[k++] = a[i + __builtin_ctz(mask)];
+                        mask &= mask - 1;
+                    }
+                } else {
+                    k += __builtin_popcount(mask);
+                }
+
+                vertex_t a_last = a[i + 3];
+                vertex_t b_last = b[j + 3];
+                i += a_last <= b_last ? 4 : 0;
+                j += b_last <= a_last ? 4 : 0;
+            }
+
+            return k + intersectScalar<Write>(a + i, na - i, b + j, nb - j, out + k);
+        }
+
+        // A union has no work to skip, but runs of one input that end before
+        // the other's next value are stored a whole block at a time
+
+        __attribute__((target("sse4.1")))
+        size_t unionSse41(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            size_t i = 0;
+            size_t j = 0;
+            size_t k = 0;
+            while ( i + 2 <= na && j + 2 <= nb ) {
+                if ( a[i + 1] < b[j] ) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)));
+                    i += 2;
+                    k += 2;
+                } else if ( b[j + 1] < a[i] ) {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k),
+                                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j)));
+                    j += 2;
+                    k += 2;
+                } else {
+                    vertex_t x = a[i];
+                    vertex_t y = b[j];
+                    out[k++] = x <= y ? x : y;
+                    i += x <= y;
+                    j += y <= x;
+                }
+            }
+
+            return k + unionScalar(a + i, na - i, b + j, nb - j, out + k);
+        }
+
+        __attribute__((target("avx2")))
+        size_t unionAvx2(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out) {
+            size_t i = 0;
+            size_t j = 0;
+            size_t k = 0;
+            while ( i + 4 <= na && j + 4 <= nb ) {
+                if ( a[i + 3] < b[j] ) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+                    i += 4;
+                    k += 4;
+                } else if ( b[j + 3] < a[i] ) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k),
+                                        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + j)));
+                    j += 4;
+                    k += 4;
+                } else {
+                    vertex_t x = a[i];
+                    vertex_t y = b[j];
+                    out[k++] = x <= y ? x : y;
+                    i += x <= y;
+                    j += y <= x;
+                }
+            }
+
+            return k + unionScalar(a + i, na - i, b + j, nb - j, out + k);
+        }
+
+#endif
+
+        SimdLevel resolveLevel(SimdLevel level) {
+            static const SimdLevel supported = detectSimdLevel();
+            if ( level == SimdLevel::AUTO || level > supported ) { return supported; }
+            return level;
+        }
+
+        // Sizes at which the block kernels pay off over the scalar merge,
+        // which also covers the galloping case
+        bool useBlocks(size_t na, size_t nb) {
+            size_t small = std::min(na, nb);
+            size_t large = std::max(na, nb);
+            return small >= 4 && small * GALLOP_RATIO >= large;
+        }
+
+        template <bool Write>
+        size_t intersect(const vertex_t * a, size_t na, const vertex_t * b, size_t nb, vertex_t * out, SimdLevel level) {
+#ifdef GRAPPH_X86_SIMD
+            if ( useBlocks(na, nb) ) {
+                switch ( resolveLevel(level) ) {
+                    case SimdLevel::AVX2:   return intersectAvx2<Write>(a, na, b, nb, out);
+                    case SimdLevel::SSE41:  return intersectSse41<Write>(a, na, b, nb, out);
+                    default:                break;
+                }
+            }
+#else
+            (void) level;
+#endif
+            return intersectScalar<Write>(a, na, b, nb, out);
+        }
+
+    }
+
+    SimdLevel detectSimdLevel() {
+#ifdef GRAPPH_X86_SIMD
+        if ( __builtin_cpu_supports("avx2") ) { return SimdLevel::AVX2; }
+        if ( __builtin_cpu_supports("sse4.1") ) { return SimdLevel::SSE41; }
+#endif
+        return SimdLevel::SCALAR;
+    }
+
+    size_t sortedIntersection(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                              vertex_t * out, SimdLevel level) {
+        return intersect<true>(a, na, b, nb, out, level);
+    }
+
+    size_t sortedIntersectionCount(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                                   SimdLevel level) {
+        return intersect<false>(a, na, b, nb, nullptr, level);
+    }
+
+    size_t sortedUnion(const vertex_t * a, size_t na, const vertex_t * b, size_t nb,
+                       vertex_t * out, SimdLevel level) {
+#ifdef GRAPPH_X86_SIMD
+        switch ( resolveLevel(level) ) {
+            case SimdLevel::AVX2:   return unionAvx2(a, na, b, nb, out);
+            case SimdLevel::SSE41:  return unionSse41(a, na, b, nb, out);
+            default:                break;
+        }
+#else
+        (void) level;
+#endif
+        return unionScalar(a, na, b, nb, out);
+    }
+
+    std::vector<vertex_t> sortedIntersection(const std::vector<vertex_t> & a, const std::vector<vertex_t> & b) {
+        std::vector<vertex_t> result(std::min(a.size(), b.size()));
+        result.resize(sortedIntersection(a.data(), a.size(), b.data(), b.size(), result.data()));
+
+        return result;
+    }
+
+    std::vector<vertex_t> sortedUnion(const std::vector<vertex_t> & a, const std::vector<vertex_t> & b) {
+        std::vector<vertex_t> result(a.size() + b.size());
+        result.resize(sortedUnion(a.data(), a.size(), b.data(), b.size(), result.data()));
+
+        return result;
+    }
+
+}
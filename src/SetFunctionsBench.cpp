@@ -0,0 +1,154 @@
+#include "benchmark/benchmark.h"
+
+#include "SetFunctions.h"
+
+#include <random>
+
+// The element-at-a-time templates the merge versions replaced, kept here as
+// the baseline
+template <typename T>
+static std::set<T> lookupIntersection(const std::set<T>& first, const std::set<T>& second) {
+    std::set<T> set_intersection;
+    for ( T t : first ) {
+        if ( second.count(t) != 0 )  set_intersection.insert(t);
+    }
+    return set_intersection;
+}
+
+template <typename T>
+static std::set<T> lookupUnion(const std::set<T>& first, const std::set<T>& second) {
+    std::set<T> set_union;
+    for ( T t : first ) { set_union.insert(t); }
+    for ( T t : second ) { set_union.insert(t); }
+    return set_union;
+}
+
+template <typename T>
+static bool lookupContains(const std::set<T>& super, const std::set<T>& sub) {
+    for ( T t : sub ) {
+        if ( super.count(t) == 0 )  return false;
+    }
+    return true;
+}
+
+// Two sorted sets of n ids drawn from [0, 2n), so about half of each is shared
+static std::pair<std::set<grapph::vertex_t>, std::set<grapph::vertex_t>> randomSets(size_t n) {
+    std::mt19937_64 rng(n);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 2 * n - 1);
+
+    std::set<grapph::vertex_t> a;
+    std::set<grapph::vertex_t> b;
+    while ( a.size() < n ) { a.insert(pick(rng)); }
+    while ( b.size() < n ) { b.insert(pick(rng)); }
+
+    return { a, b };
+}
+
+static void BM_SetIntersectionLookup(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    for ( auto _ : state ) { benchmark::DoNotOptimize(lookupIntersection(sets.first, sets.second)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetIntersectionLookup)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_SetIntersectionMerge(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    for ( auto _ : state ) { benchmark::DoNotOptimize(grapph::setIntersection(sets.first, sets.second)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetIntersectionMerge)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_SetUnionLookup(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    for ( auto _ : state ) { benchmark::DoNotOptimize(lookupUnion(sets.first, sets.second)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetUnionLookup)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_SetUnionMerge(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    for ( auto _ : state ) { benchmark::DoNotOptimize(grapph::setUnion(sets.first, sets.second)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetUnionMerge)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_SetEqualsLookup(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::set<grapph::vertex_t> copy = sets.first;
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(lookupContains(sets.first, copy) && lookupContains(copy, sets.first));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetEqualsLookup)->Arg(1 << 8)->Arg(1 << 14);
+
+static void BM_SetEqualsMerge(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::set<grapph::vertex_t> copy = sets.first;
+    for ( auto _ : state ) { benchmark::DoNotOptimize(grapph::setEquals(sets.first, copy)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetEqualsMerge)->Arg(1 << 8)->Arg(1 << 14);
+
+// Sorted array kernels at each instruction set level; arg 1 is the SimdLevel
+static void BM_SortedIntersection(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::vector<grapph::vertex_t> a(sets.first.begin(), sets.first.end());
+    std::vector<grapph::vertex_t> b(sets.second.begin(), sets.second.end());
+    std::vector<grapph::vertex_t> out(a.size());
+    grapph::SimdLevel level = static_cast<grapph::SimdLevel>(state.range(1));
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::sortedIntersection(a.data(), a.size(), b.data(), b.size(), out.data(), level));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SortedIntersection)->ArgsProduct({ { 1 << 8, 1 << 14 }, { 1, 2, 3 } });
+
+static void BM_SortedIntersectionCount(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::vector<grapph::vertex_t> a(sets.first.begin(), sets.first.end());
+    std::vector<grapph::vertex_t> b(sets.second.begin(), sets.second.end());
+    grapph::SimdLevel level = static_cast<grapph::SimdLevel>(state.range(1));
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::sortedIntersectionCount(a.data(), a.size(), b.data(), b.size(), level));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SortedIntersectionCount)->ArgsProduct({ { 1 << 8, 1 << 14 }, { 1, 2, 3 } });
+
+static void BM_SortedUnion(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::vector<grapph::vertex_t> a(sets.first.begin(), sets.first.end());
+    std::vector<grapph::vertex_t> b(sets.second.begin(), sets.second.end());
+    std::vector<grapph::vertex_t> out(a.size() + b.size());
+    grapph::SimdLevel level = static_cast<grapph::SimdLevel>(state.range(1));
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(grapph::sortedUnion(a.data(), a.size(), b.data(), b.size(), out.data(), level));
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SortedUnion)->ArgsProduct({ { 1 << 8, 1 << 14 }, { 1, 2, 3 } });
+
+static void BM_SetDifference(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    for ( auto _ : state ) { benchmark::DoNotOptimize(grapph::setDifference(sets.first, sets.second)); }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_SetDifference)->Arg(1 << 8)->Arg(1 << 14);
+
+// A subset that is actually contained, so the whole of it is walked
+static void BM_SetContains(benchmark::State & state) {
+    auto sets = randomSets(state.range(0));
+    std::set<grapph::vertex_t> half;
+    bool keep = true;
+    for ( grapph::vertex_t t : sets.first ) {
+        if ( keep ) { half.insert(half.end(), t); }
+        keep = !keep;
+    }
+    for ( auto _ : state ) { benchmark::DoNotOptimize(grapph::setContains(sets.first, half)); }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SetContains)->Arg(1 << 8)->Arg(1 << 14);
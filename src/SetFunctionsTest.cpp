@@ -2,6 +2,10 @@
 
 #include "SetFunctions.h"
 
+#include <algorithm>
+#include <iterator>
+#include <random>
+
 TEST(SetFunctionsTest, TestSetEquals1) {
 
     // Create two equal sets of size_t
@@ -163,3 +167,65 @@ TEST(SetFunctionsTest, TestSetDifference2) {
     ASSERT_TRUE(grapph::setContains(b, backwards));
 
 }
+
+TEST(SetFunctionsTest, TestSkewedSets) {
+
+    // A small set against a much larger one takes the lookup path
+    std::set<size_t> small = { 3, 500, 1001 };
+    std::set<size_t> large;
+    for ( size_t i = 0; i < 1000; i++ ) { large.insert(i); }
+
+    // Assertions
+    ASSERT_EQ(std::set<size_t>({ 3, 500 }), grapph::setIntersection(small, large));
+    ASSERT_EQ(std::set<size_t>({ 3, 500 }), grapph::setIntersection(large, small));
+    ASSERT_EQ(std::set<size_t>({ 1001 }), grapph::setDifference(small, large));
+    ASSERT_EQ(998, grapph::setDifference(large, small).size());
+    ASSERT_FALSE(grapph::setContains(large, small));
+    small.erase(1001);
+    ASSERT_TRUE(grapph::setContains(large, small));
+    ASSERT_EQ(1000, grapph::setUnion(small, large).size());
+
+}
+
+TEST(SetFunctionsTest, TestSortedKernels) {
+
+    std::mt19937_64 rng(11);
+    std::vector<grapph::SimdLevel> levels = { grapph::SimdLevel::SCALAR, grapph::SimdLevel::SSE41,
+                                             grapph::SimdLevel::AVX2, grapph::SimdLevel::AUTO };
+
+    // Sizes cover empty inputs, partial blocks, and the galloping ratio
+    std::vector<std::pair<size_t, size_t>> sizes = { { 0, 5 }, { 3, 7 }, { 17, 19 }, { 64, 64 },
+                                                     { 100, 3 }, { 5, 1000 }, { 500, 2000 } };
+    for ( const std::pair<size_t, size_t> & size : sizes ) {
+        for ( size_t range : { 2, 4, 16 } ) {
+            std::uniform_int_distribution<size_t> pick(0, range * (size.first + size.second));
+            std::set<size_t> a_set;
+            std::set<size_t> b_set;
+            while ( a_set.size() < size.first ) { a_set.insert(pick(rng)); }
+            while ( b_set.size() < size.second ) { b_set.insert(pick(rng)); }
+            std::vector<grapph::vertex_t> a(a_set.begin(), a_set.end());
+            std::vector<grapph::vertex_t> b(b_set.begin(), b_set.end());
+
+            std::vector<grapph::vertex_t> expected_intersection;
+            std::vector<grapph::vertex_t> expected_union;
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_intersection));
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected_union));
+
+            for ( grapph::SimdLevel level : levels ) {
+                std::vector<grapph::vertex_t> out(a.size() + b.size());
+                out.resize(grapph::sortedIntersection(a.data(), a.size(), b.data(), b.size(), out.data(), level));
+                ASSERT_EQ(expected_intersection, out);
+                ASSERT_EQ(expected_intersection.size(),
+                          grapph::sortedIntersectionCount(b.data(), b.size(), a.data(), a.size(), level));
+
+                out.resize(a.size() + b.size());
+                out.resize(grapph::sortedUnion(a.data(), a.size(), b.data(), b.size(), out.data(), level));
+                ASSERT_EQ(expected_union, out);
+            }
+
+            ASSERT_EQ(expected_intersection, grapph::sortedIntersection(a, b));
+            ASSERT_EQ(expected_union, grapph::sortedUnion(b, a));
+        }
+    }
+
+}
@@ -0,0 +1,59 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "ShortestPaths.h"
+
+// Random graph with integer weights 1..100 on its edges
+static grapph::FeatureGraph<int, int> randomWeightedGraph(size_t n, size_t degree) {
+    std::mt19937_64 rng(n + degree);
+    std::uniform_int_distribution<int> weigh(1, 100);
+
+    std::vector<std::pair<grapph::vertex_t, int>> vertices;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.push_back({ u, 0 }); }
+    std::vector<std::pair<grapph::edge_t, int>> edges;
+    for ( const grapph::edge_t & edge : randomEdgeList(n, degree) ) { edges.push_back({ edge, weigh(rng) }); }
+
+    return grapph::FeatureGraph<int, int>(vertices, edges);
+}
+
+static void BM_ShortestPathsDijkstra(benchmark::State & state) {
+    grapph::FeatureGraph<int, int> graph = randomWeightedGraph(state.range(0), state.range(1));
+    grapph::ShortestPaths<int, int> paths(graph);
+
+    for ( auto _ : state ) { paths.dijkstra(0); }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_ShortestPathsDijkstra)->Args({1 << 14, 8})->Args({1 << 17, 8})->Unit(benchmark::kMillisecond);
+
+// Arg 2 is the thread count
+static void BM_ShortestPathsDeltaStepping(benchmark::State & state) {
+    grapph::FeatureGraph<int, int> graph = randomWeightedGraph(state.range(0), state.range(1));
+    grapph::ShortestPaths<int, int> paths(graph);
+    paths.setThreads(state.range(2));
+
+    for ( auto _ : state ) { paths.deltaStepping(0); }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_ShortestPathsDeltaStepping)->ArgsProduct({ { 1 << 14, 1 << 17 }, { 8 }, { 1, 4 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// Point-to-point queries between random pairs, one-sided against bidirectional
+static void BM_ShortestPathsQuery(benchmark::State & state) {
+    grapph::FeatureGraph<int, int> graph = randomWeightedGraph(state.range(0), state.range(1));
+    grapph::ShortestPaths<int, int> paths(graph);
+    std::mt19937_64 rng(3);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, state.range(0) - 1);
+
+    for ( auto _ : state ) {
+        grapph::vertex_t source = pick(rng);
+        grapph::vertex_t target = pick(rng);
+        if ( state.range(2) == 0 ) {
+            paths.dijkstra(source);
+            benchmark::DoNotOptimize(paths.getDistance(target));
+        } else {
+            benchmark::DoNotOptimize(paths.bidirectional(source, target));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ShortestPathsQuery)->ArgsProduct({ { 1 << 16 }, { 8 }, { 0, 1 } })->Unit(benchmark::kMillisecond);
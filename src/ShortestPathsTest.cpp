@@ -0,0 +1,145 @@
+#include "gtest/gtest.h"
+
+#include "ShortestPaths.h"
+
+#include <cmath>
+#include <random>
+
+// Square 0 - 1 - 2 - 3 - 0 with a heavy diagonal, a tail and an isolated vertex
+static grapph::FeatureGraph<int, double> weightedSquare() {
+    return grapph::FeatureGraph<int, double>(
+            { {0, 0}, {1, 0}, {2, 0}, {3, 0}, {4, 0}, {8, 0} },
+            { {{0, 1}, 1}, {{1, 2}, 2}, {{2, 3}, 1}, {{0, 3}, 5}, {{0, 2}, 4}, {{3, 4}, 0.5}, {{4, 4}, 1} });
+}
+
+TEST(ShortestPathsTest, TestDijkstra) {
+    grapph::FeatureGraph<int, double> graph = weightedSquare();
+    grapph::ShortestPaths<int, double> paths(graph);
+    paths.dijkstra(0);
+
+    // Assertions
+    ASSERT_DOUBLE_EQ(0, paths.getDistance(0));
+    ASSERT_DOUBLE_EQ(3, paths.getDistance(2));
+    ASSERT_DOUBLE_EQ(4, paths.getDistance(3));
+    ASSERT_DOUBLE_EQ(4.5, paths.getDistance(4));
+    ASSERT_TRUE(std::isinf(paths.getDistance(8)));
+    ASSERT_FALSE(paths.reached(8));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 0, 1, 2, 3, 4 }), paths.getPath(4));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 0 }), paths.getPath(0));
+    ASSERT_TRUE(paths.getPath(8).empty());
+    ASSERT_THROW(paths.dijkstra(5), std::invalid_argument);
+    ASSERT_THROW(paths.getDistance(5), std::invalid_argument);
+}
+
+TEST(ShortestPathsTest, TestProjection) {
+    // Edge states are strings; the projection reads their length
+    grapph::FeatureGraph<int, std::string> graph(
+            { {0, 0}, {1, 0}, {2, 0} },
+            { {{0, 1}, "aaaa"}, {{1, 2}, "a"}, {{0, 2}, "aaaaaaa"} });
+    grapph::ShortestPaths<int, std::string> paths(graph, [](const std::string & state) { return state.size(); });
+
+    // Assertions
+    paths.dijkstra(0);
+    ASSERT_DOUBLE_EQ(5, paths.getDistance(2));
+    ASSERT_DOUBLE_EQ(5, paths.bidirectional(2, 0));
+
+    // Negative distances are rejected
+    grapph::FeatureGraph<int, int> negative({ {0, 0}, {1, 0} }, { {{0, 1}, -2} });
+    ASSERT_THROW((grapph::ShortestPaths<int, int>(negative)), std::invalid_argument);
+}
+
+TEST(ShortestPathsTest, TestBidirectional) {
+    grapph::FeatureGraph<int, double> graph = weightedSquare();
+    grapph::ShortestPaths<int, double> paths(graph);
+
+    // Assertions
+    std::vector<grapph::vertex_t> path;
+    ASSERT_DOUBLE_EQ(4.5, paths.bidirectional(0, 4, &path));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 0, 1, 2, 3, 4 }), path);
+    ASSERT_DOUBLE_EQ(0, paths.bidirectional(2, 2, &path));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 2 }), path);
+    ASSERT_TRUE(std::isinf(paths.bidirectional(0, 8, &path)));
+    ASSERT_TRUE(path.empty());
+    ASSERT_THROW(paths.bidirectional(0, 5), std::invalid_argument);
+}
+
+TEST(ShortestPathsTest, TestAlgorithmsAgree) {
+    // Random weighted graph with some heavy edges and a few unreachable vertices
+    std::mt19937_64 rng(9);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 1489);
+    std::uniform_int_distribution<int> weigh(1, 100);
+    std::vector<std::pair<grapph::vertex_t, int>> vertices;
+    for ( grapph::vertex_t u = 0; u < 1500; u++ ) { vertices.push_back({ u, 0 }); }
+    std::set<grapph::edge_t> seen;
+    std::vector<std::pair<grapph::edge_t, int>> edges;
+    while ( edges.size() < 6000 ) {
+        grapph::vertex_t u = pick(rng);
+        grapph::vertex_t w = pick(rng);
+        if ( seen.insert({ std::min(u, w), std::max(u, w) }).second ) { edges.push_back({ { u, w }, weigh(rng) }); }
+    }
+    grapph::FeatureGraph<int, int> graph(vertices, edges);
+
+    grapph::ShortestPaths<int, int> reference(graph);
+    reference.dijkstra(0);
+
+    for ( double delta : { 0.0, 5.0, 1000.0 } ) {
+        for ( size_t threads : { 1, 4 } ) {
+            grapph::ShortestPaths<int, int> stepping(graph);
+            stepping.setThreads(threads).setDelta(delta).deltaStepping(0);
+
+            // Assertions
+            for ( grapph::vertex_t u = 0; u < 1500; u++ ) {
+                ASSERT_EQ(reference.getDistance(u), stepping.getDistance(u));
+                std::vector<grapph::vertex_t> path = stepping.getPath(u);
+                if ( !stepping.reached(u) ) {
+                    ASSERT_TRUE(path.empty());
+                    continue;
+                }
+
+                // Walking the path adds up to the distance
+                double length = 0;
+                for ( size_t i = 1; i < path.size(); i++ ) { length += graph.getEdgeState({ std::min(path[i - 1], path[i]), std::max(path[i - 1], path[i]) }); }
+                ASSERT_DOUBLE_EQ(stepping.getDistance(u), length);
+            }
+        }
+    }
+
+    for ( size_t i = 0; i < 50; i++ ) {
+        grapph::vertex_t target = pick(rng);
+        ASSERT_EQ(reference.getDistance(target), reference.bidirectional(0, target));
+    }
+}
+
+TEST(ShortestPathsTest, TestZeroWeights) {
+    // Zero weights tie distances, which must not make parents point at each other
+    grapph::FeatureGraph<int, double> graph({ {1, 0}, {2, 0}, {3, 0}, {4, 0} },
+                                            { {{2, 3}, 1.0}, {{1, 2}, 0.0}, {{1, 4}, 0.0}, {{2, 4}, 0.0} });
+    grapph::ShortestPaths<int, double> paths(graph);
+
+    // Assertions; results are only there after a run
+    ASSERT_THROW(paths.getDistance(1), std::logic_error);
+    ASSERT_THROW(paths.reached(1), std::logic_error);
+    ASSERT_THROW(paths.getPath(1), std::logic_error);
+
+    for ( size_t threads : { 1, 4 } ) {
+        paths.setThreads(threads).deltaStepping(3);
+        ASSERT_DOUBLE_EQ(1, paths.getDistance(1));
+        ASSERT_DOUBLE_EQ(1, paths.getDistance(4));
+        std::vector<grapph::vertex_t> path = paths.getPath(1);
+        ASSERT_EQ(3, path.front());
+        ASSERT_EQ(1, path.back());
+        ASSERT_GE(3, path.size());
+        ASSERT_EQ(std::vector<grapph::vertex_t>({ 3 }), paths.getPath(3));
+    }
+}
+
+TEST(ShortestPathsTest, TestWideWeights) {
+    // The heavy edge jumps a thousand buckets ahead
+    grapph::FeatureGraph<int, double> graph({ {0, 0}, {1, 0}, {2, 0} }, { {{0, 1}, 1e9}, {{1, 2}, 0.5} });
+    grapph::ShortestPaths<int, double> paths(graph);
+    paths.setDelta(1e6).deltaStepping(0);
+
+    // Assertions
+    ASSERT_DOUBLE_EQ(1e9 + 0.5, paths.getDistance(2));
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 0, 1, 2 }), paths.getPath(2));
+}
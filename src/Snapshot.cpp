@@ -0,0 +1,182 @@
+#include "Snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    namespace {
+
+        const char MAGIC[8] = { 'G', 'R', 'A', 'P', 'P', 'H', 'S', 'S' };
+        // Reads back differently on a machine of the other byte order
+        const uint64_t BYTE_ORDER_MARK = 0x0102030405060708ULL;
+        const uint64_t ALIGNMENT = 64;
+
+        const uint32_t HAS_COLUMNS = 1;
+        const uint32_t IDENTITY_IDS = 2;
+
+        // Structure sections, then the state columns in Snapshot::Column order
+        enum SectionId { IDS, OFFSETS, NEIGHBORS, VERTEX_STATES, EDGE_LIST, EDGE_STATES, SLOT_EDGES, NUM_SECTIONS };
+
+        struct Section {
+            uint64_t offset;
+            uint64_t bytes;
+        };
+
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t flags;
+            uint64_t byte_order;
+            uint64_t word_size;
+            uint64_t num_vertices;
+            uint64_t num_edges;
+            uint64_t num_slots;
+            uint64_t vertex_state_size;
+            uint64_t edge_state_size;
+            Section sections[NUM_SECTIONS];
+        };
+
+        uint64_t align(uint64_t offset) {
+            return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+        }
+
+        void fail(const std::string & path, const std::string & reason) {
+            std::stringstream ss;
+            ss << "Snapshot " << path << ": " << reason;
+            throw std::invalid_argument(ss.str());
+        }
+
+        void expect(const std::string & path, const Header & header, size_t id, uint64_t bytes, uint64_t size) {
+            const Section & section = header.sections[id];
+            if ( section.offset % ALIGNMENT != 0 || section.offset > size || section.bytes > size - section.offset ) {
+                fail(path, "section out of bounds");
+            }
+            if ( section.bytes != bytes ) { fail(path, "section size does not match header"); }
+        }
+
+    }
+
+    void Snapshot::write(const std::string & path, const CompactGraph & graph, size_t vertex_state_size,
+                         size_t edge_state_size, const std::vector<Column> & columns) {
+        // A default-constructed graph has no offsets at all
+        size_t zero = 0;
+        const Buffer<vertex_t> & ids = graph.index.getIds();
+        std::vector<Column> sections = {
+                { ids.data(), ids.size() * sizeof(vertex_t) },
+                graph.offsets.empty() ? Column { &zero, sizeof(size_t) }
+                                      : Column { graph.offsets.data(), graph.offsets.size() * sizeof(size_t) },
+                { graph.neighbors.data(), graph.neighbors.size() * sizeof(vertex_t) } };
+        sections.insert(sections.end(), columns.begin(), columns.end());
+
+        Header header;
+        std::memset(&header, 0, sizeof(header));
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.flags = (columns.empty() ? 0 : HAS_COLUMNS) | (graph.index.isIdentity() ? IDENTITY_IDS : 0);
+        header.byte_order = BYTE_ORDER_MARK;
+        header.word_size = sizeof(vertex_t);
+        header.num_vertices = graph.getNumVertices();
+        header.num_edges = graph.getNumEdges();
+        header.num_slots = graph.getNumSlots();
+        header.vertex_state_size = vertex_state_size;
+        header.edge_state_size = edge_state_size;
+
+        uint64_t offset = align(sizeof(Header));
+        for ( size_t id = 0; id < sections.size(); id++ ) {
+            header.sections[id] = { offset, sections[id].bytes };
+            offset = align(offset + sections[id].bytes);
+        }
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if ( !out ) { fail(path, "cannot open for writing"); }
+
+        const char padding[ALIGNMENT] = {};
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        uint64_t written = sizeof(header);
+        for ( size_t id = 0; id < sections.size(); id++ ) {
+            out.write(padding, header.sections[id].offset - written);
+            out.write(static_cast<const char*>(sections[id].data), sections[id].bytes);
+            written = header.sections[id].offset + sections[id].bytes;
+        }
+
+        out.flush();
+        if ( !out ) { fail(path, "write failed"); }
+    }
+
+    CompactGraph Snapshot::map(const std::string & path, size_t vertex_state_size, size_t edge_state_size,
+                               std::vector<Column> * columns, std::shared_ptr<const void> * owner) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if ( fd < 0 ) { fail(path, "cannot open"); }
+
+        struct stat info;
+        if ( fstat(fd, &info) != 0 || static_cast<uint64_t>(info.st_size) < sizeof(Header) ) {
+            close(fd);
+            fail(path, "not a snapshot");
+        }
+
+        // Private pages: state updates copy the page instead of writing the file
+        size_t size = info.st_size;
+        void * address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if ( address == MAP_FAILED ) { fail(path, "cannot map"); }
+        std::shared_ptr<const void> mapping(address, [size](const void * pages) {
+            munmap(const_cast<void*>(pages), size);
+        });
+
+        const char * base = static_cast<const char*>(address);
+        const Header & header = *reinterpret_cast<const Header*>(base);
+        if ( std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ) { fail(path, "not a snapshot"); }
+        if ( header.version != VERSION ) {
+            std::stringstream ss;
+            ss << "unsupported version " << header.version;
+            fail(path, ss.str());
+        }
+        if ( header.byte_order != BYTE_ORDER_MARK || header.word_size != sizeof(vertex_t) ) {
+            fail(path, "written on an incompatible machine");
+        }
+
+        // Sizes are checked, contents are trusted
+        uint64_t n = header.num_vertices;
+        uint64_t m = header.num_edges;
+        uint64_t slots = header.num_slots;
+        expect(path, header, IDS, n * sizeof(vertex_t), size);
+        expect(path, header, OFFSETS, (n + 1) * sizeof(size_t), size);
+        expect(path, header, NEIGHBORS, slots * sizeof(vertex_t), size);
+        const Section * sections = header.sections;
+        const size_t * offsets = reinterpret_cast<const size_t*>(base + sections[OFFSETS].offset);
+        if ( offsets[0] != 0 || offsets[n] != slots ) { fail(path, "offsets do not match header"); }
+
+        if ( columns != nullptr ) {
+            if ( !(header.flags & HAS_COLUMNS) ) { fail(path, "no state columns"); }
+            if ( header.vertex_state_size != vertex_state_size || header.edge_state_size != edge_state_size ) {
+                fail(path, "state sizes do not match");
+            }
+            expect(path, header, VERTEX_STATES, n * vertex_state_size, size);
+            expect(path, header, EDGE_LIST, m * sizeof(edge_t), size);
+            expect(path, header, EDGE_STATES, m * edge_state_size, size);
+            expect(path, header, SLOT_EDGES, slots * sizeof(size_t), size);
+
+            columns->clear();
+            for ( size_t id = VERTEX_STATES; id < NUM_SECTIONS; id++ ) {
+                columns->push_back({ base + sections[id].offset, sections[id].bytes });
+            }
+            *owner = mapping;
+        }
+
+        auto section = [&](size_t id) { return const_cast<char*>(base + sections[id].offset); };
+        VertexIndex index(Buffer<vertex_t>(reinterpret_cast<vertex_t*>(section(IDS)), n, mapping),
+                          (header.flags & IDENTITY_IDS) != 0);
+
+        return CompactGraph(std::move(index), Buffer<size_t>(reinterpret_cast<size_t*>(section(OFFSETS)), n + 1, mapping),
+                            Buffer<vertex_t>(reinterpret_cast<vertex_t*>(section(NEIGHBORS)), slots, mapping), m);
+    }
+
+}
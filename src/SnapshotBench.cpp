@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "Snapshot.h"
+
+#include <cstdio>
+
+// Rebuilding from an edge list, as a restart does without snapshots
+static void BM_SnapshotRebuild(benchmark::State & state) {
+    std::vector<grapph::edge_t> edge_list = randomEdgeList(state.range(0), state.range(1));
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < static_cast<grapph::vertex_t>(state.range(0)); u++ ) {
+        vertices.insert(vertices.end(), u);
+    }
+
+    for ( auto _ : state ) {
+        grapph::Graph graph(vertices, std::set<grapph::edge_t>(edge_list.begin(), edge_list.end()));
+        grapph::CompactGraph frozen(graph);
+        benchmark::DoNotOptimize(frozen.getNumEdges());
+    }
+    state.SetItemsProcessed(state.iterations() * edge_list.size());
+}
+BENCHMARK(BM_SnapshotRebuild)->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_SnapshotSave(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+    std::string path = "grapph_bench.snap";
+
+    for ( auto _ : state ) { grapph::Snapshot::save(path, frozen); }
+    state.SetItemsProcessed(state.iterations() * frozen.getNumEdges());
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_SnapshotSave)->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
+
+// Mapping alone, then mapping plus one pass over every row
+static void BM_SnapshotLoad(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    std::string path = "grapph_bench.snap";
+    grapph::Snapshot::save(path, graph);
+
+    for ( auto _ : state ) {
+        grapph::CompactGraph loaded = grapph::Snapshot::load(path);
+        size_t sum = 0;
+        if ( state.range(2) != 0 ) {
+            for ( grapph::vertex_t u : loaded.viewVertices() ) { sum += loaded.getDegree(u); }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+    std::remove(path.c_str());
+}
+BENCHMARK(BM_SnapshotLoad)->ArgsProduct({ { 1 << 16 }, { 16 }, { 0, 1 } });
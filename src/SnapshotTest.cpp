@@ -0,0 +1,107 @@
+#include "gtest/gtest.h"
+
+#include "Snapshot.h"
+
+#include <cstdio>
+#include <fstream>
+
+static std::string snapshotPath(const std::string & name) {
+    return testing::TempDir() + "grapph_" + name + ".snap";
+}
+
+TEST(SnapshotTest, TestRoundTrip) {
+    // Initialize graph with sparse ids, a self loop, and an isolated vertex
+    grapph::Graph graph({ 1, 4, 6, 10, 12 }, { {1, 4}, {4, 6}, {1, 6}, {6, 10}, {10, 10} });
+    std::string path = snapshotPath("round_trip");
+    grapph::Snapshot::save(path, graph);
+
+    grapph::CompactGraph loaded = grapph::Snapshot::load(path);
+
+    // Assertions
+    ASSERT_TRUE(loaded.isMapped());
+    ASSERT_EQ(5, loaded.getNumVertices());
+    ASSERT_EQ(5, loaded.getNumEdges());
+    ASSERT_TRUE(loaded.adjacent(6, 1));
+    ASSERT_TRUE(loaded.adjacent(10, 10));
+    ASSERT_FALSE(loaded.adjacent(1, 10));
+    ASSERT_EQ(0, loaded.getDegree(12));
+    ASSERT_EQ(graph.getEdges(), loaded.getEdges());
+    ASSERT_THROW(loaded.getDegree(5), std::invalid_argument);
+
+    // Copies own their arrays and outlive the mapping
+    grapph::CompactGraph copy = loaded;
+    loaded = grapph::CompactGraph();
+    ASSERT_FALSE(copy.isMapped());
+    ASSERT_EQ(graph.getVertices(), copy.getVertices());
+
+    // Dense ids and empty graphs
+    grapph::Graph dense({ 0, 1, 2 }, { {0, 1}, {1, 2} });
+    grapph::Snapshot::save(path, dense);
+    ASSERT_EQ(dense.getEdges(), grapph::Snapshot::load(path).getEdges());
+    grapph::Snapshot::save(path, grapph::CompactGraph());
+    ASSERT_EQ(0, grapph::Snapshot::load(path).getNumVertices());
+
+    std::remove(path.c_str());
+}
+
+TEST(SnapshotTest, TestFeatureColumns) {
+    grapph::FeatureGraph<int, double> source({ {0, 7}, {3, 8}, {5, 9} },
+                                             { {{0, 3}, 1.5}, {{3, 5}, 2.5}, {{5, 5}, 4.0} });
+    std::string path = snapshotPath("features");
+    grapph::Snapshot::save(path, source);
+
+    grapph::ColumnarFeatureGraph<int, double> loaded = grapph::Snapshot::loadFeatures<int, double>(path);
+
+    // Assertions
+    ASSERT_TRUE(loaded.getGraph().isMapped());
+    ASSERT_EQ(8, loaded.getVertexState(3));
+    ASSERT_EQ(2.5, loaded.getEdgeState({5, 3}));
+    ASSERT_EQ(4.0, loaded.getEdgeState({5, 5}));
+    ASSERT_EQ(std::vector<int>({ 7, 8, 9 }), loaded.viewVertexStates());
+    for ( grapph::vertex_t u : loaded.getGraph().viewVertices() ) {
+        ASSERT_EQ(loaded.getGraph().getDegree(u), loaded.viewIncidentEdges(u).size());
+    }
+
+    // Updates land in private pages, not in the file
+    loaded.updateEdge({0, 3}, 10.0);
+    ASSERT_EQ(10.0, loaded.getEdgeState({0, 3}));
+    ASSERT_EQ(1.5, (grapph::Snapshot::loadFeatures<int, double>(path).getEdgeState({0, 3})));
+
+    // Structure alone loads from the same file
+    ASSERT_EQ(3, grapph::Snapshot::load(path).getNumEdges());
+
+    std::remove(path.c_str());
+}
+
+TEST(SnapshotTest, TestRejectsBadFiles) {
+    std::string path = snapshotPath("bad");
+
+    // Missing, foreign, and truncated files
+    std::remove(path.c_str());
+    ASSERT_THROW(grapph::Snapshot::load(path), std::invalid_argument);
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(512, 'x');
+    }
+    ASSERT_THROW(grapph::Snapshot::load(path), std::invalid_argument);
+
+    grapph::Graph graph({ 1, 2, 3 }, { {1, 2}, {2, 3} });
+    grapph::Snapshot::save(path, graph);
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << bytes.substr(0, bytes.size() - 8);
+    }
+    ASSERT_THROW(grapph::Snapshot::load(path), std::invalid_argument);
+
+    // Structure-only snapshots and mismatched state types have no usable columns
+    grapph::Snapshot::save(path, graph);
+    ASSERT_THROW((grapph::Snapshot::loadFeatures<int, int>(path)), std::invalid_argument);
+    grapph::FeatureGraph<int, double> source({ {1, 1}, {2, 2} }, { {{1, 2}, 0.5} });
+    grapph::Snapshot::save(path, source);
+    ASSERT_THROW((grapph::Snapshot::loadFeatures<int, float>(path)), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,383 @@
+#include "SubgraphSearch.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <deque>
+#include <thread>
+
+namespace grapph {
+
+    struct SubgraphSearch::State {
+        // Target position chosen at each depth
+        std::vector<size_t> image;
+        // Target positions already used, for the injective kinds
+        Bitset used;
+        // Candidate lists, one per depth so they are reused across nodes
+        std::vector<std::vector<size_t>> buffers;
+        size_t nodes = 0;
+    };
+
+    struct SubgraphSearch::TaskQueue {
+        std::mutex mutex;
+        // Each task is the image of a prefix of the search order
+        std::deque<std::vector<size_t>> tasks;
+    };
+
+    SubgraphSearch::SubgraphSearch(Graph& pattern, Graph& target, MatchKind kind)
+            : pattern(pattern), target(target), kind(kind),
+              stopped(false), timed_out(false), found(0) {
+        prepare();
+    }
+
+    SubgraphSearch& SubgraphSearch::setThreads(size_t threads) {
+        this->threads = threads;
+        return *this;
+    }
+
+    SubgraphSearch& SubgraphSearch::setLimit(size_t limit) {
+        this->limit = limit;
+        return *this;
+    }
+
+    SubgraphSearch& SubgraphSearch::setTimeout(std::chrono::milliseconds timeout) {
+        this->timeout = timeout;
+        return *this;
+    }
+
+    void SubgraphSearch::prepare() {
+        pattern_index = VertexIndex(pattern.viewVertices().begin(), pattern.viewVertices().end());
+        target_index = VertexIndex(target.viewVertices().begin(), target.viewVertices().end());
+        size_t k = pattern_index.size();
+        size_t n = target_index.size();
+
+        // Rows of ids map to rows of positions in the same order
+        target_offsets.reserve(n + 1);
+        target_offsets.push_back(0);
+        for ( vertex_t vertex : target.viewVertices() ) {
+            for ( vertex_t neighbor : target.viewNeighbors(vertex) ) {
+                target_neighbors.push_back(target_index.indexOf(neighbor));
+            }
+            target_offsets.push_back(target_neighbors.size());
+        }
+
+        pattern_adjacency.assign(k, Bitset(k));
+        for ( const edge_t & edge : pattern.viewEdges() ) {
+            size_t i = pattern_index.indexOf(edge.first);
+            size_t j = pattern_index.indexOf(edge.second);
+            pattern_adjacency[i].set(j);
+            pattern_adjacency[j].set(i);
+        }
+
+        // Filter each pattern vertex's candidates by self loops and degree;
+        // injective kinds need at least as many distinct neighbors
+        domains.assign(k, Bitset(n));
+        for ( size_t p = 0; p < k; p++ ) {
+            bool pattern_loop = pattern_adjacency[p].test(p);
+            size_t pattern_degree = pattern_adjacency[p].count() - (pattern_loop ? 1 : 0);
+            for ( size_t c = 0; c < n; c++ ) {
+                bool target_loop = targetAdjacent(c, c);
+                size_t target_degree = target_offsets[c + 1] - target_offsets[c] - (target_loop ? 1 : 0);
+
+                if ( pattern_loop && !target_loop ) { continue; }
+                if ( kind == MatchKind::INDUCED && target_loop && !pattern_loop ) { continue; }
+                if ( kind == MatchKind::HOMOMORPHISM ) {
+                    if ( pattern_degree > 0 && target_degree == 0 && !target_loop ) { continue; }
+                } else if ( target_degree < pattern_degree ) {
+                    continue;
+                }
+                domains[p].set(c);
+            }
+        }
+
+        chooseOrder();
+    }
+
+    void SubgraphSearch::chooseOrder() {
+        size_t k = pattern_index.size();
+        std::vector<bool> placed(k, false);
+        std::vector<size_t> links(k, 0);
+        std::vector<size_t> degree(k);
+        std::vector<size_t> domain_size(k);
+        for ( size_t p = 0; p < k; p++ ) {
+            degree[p] = pattern_adjacency[p].count();
+            domain_size[p] = domains[p].count();
+        }
+
+        // Prefer vertices tied to the most mapped ones, then high degree,
+        // then few candidates
+        for ( size_t step = 0; step < k; step++ ) {
+            size_t best = Bitset::npos;
+            for ( size_t p = 0; p < k; p++ ) {
+                if ( placed[p] ) { continue; }
+                if ( best == Bitset::npos
+                        || links[p] > links[best]
+                        || (links[p] == links[best] && degree[p] > degree[best])
+                        || (links[p] == links[best] && degree[p] == degree[best]
+                            && domain_size[p] < domain_size[best]) ) {
+                    best = p;
+                }
+            }
+
+            placed[best] = true;
+            order.push_back(best);
+            for ( size_t q = pattern_adjacency[best].findFirst(); q != Bitset::npos;
+                  q = pattern_adjacency[best].findNext(q) ) {
+                links[q]++;
+            }
+        }
+
+        // Record which earlier depths each depth must agree with
+        back_neighbors.assign(k, std::vector<size_t>());
+        back_non_neighbors.assign(k, std::vector<size_t>());
+        for ( size_t depth = 0; depth < k; depth++ ) {
+            for ( size_t earlier = 0; earlier < depth; earlier++ ) {
+                if ( pattern_adjacency[order[depth]].test(order[earlier]) ) {
+                    back_neighbors[depth].push_back(earlier);
+                } else {
+                    back_non_neighbors[depth].push_back(earlier);
+                }
+            }
+        }
+    }
+
+    SubgraphSearch::State SubgraphSearch::makeState() const {
+        State state;
+        state.image.assign(order.size(), 0);
+        state.used = Bitset(target_index.size());
+        state.buffers.assign(order.size(), std::vector<size_t>());
+
+        return state;
+    }
+
+    bool SubgraphSearch::targetAdjacent(size_t a, size_t b) const {
+        // Search the shorter of the two rows
+        if ( target_offsets[a + 1] - target_offsets[a] > target_offsets[b + 1] - target_offsets[b] ) {
+            std::swap(a, b);
+        }
+
+        return std::binary_search(target_neighbors.begin() + target_offsets[a],
+                                  target_neighbors.begin() + target_offsets[a + 1], b);
+    }
+
+    bool SubgraphSearch::feasible(const State& state, size_t depth, size_t candidate) const {
+        if ( kind != MatchKind::HOMOMORPHISM && state.used.test(candidate) ) { return false; }
+
+        for ( size_t earlier : back_neighbors[depth] ) {
+            if ( !targetAdjacent(candidate, state.image[earlier]) ) { return false; }
+        }
+        if ( kind == MatchKind::INDUCED ) {
+            for ( size_t earlier : back_non_neighbors[depth] ) {
+                if ( targetAdjacent(candidate, state.image[earlier]) ) { return false; }
+            }
+        }
+
+        return true;
+    }
+
+    void SubgraphSearch::candidates(State& state, size_t depth) const {
+        const Bitset & domain = domains[order[depth]];
+        std::vector<size_t> & found_candidates = state.buffers[depth];
+        found_candidates.clear();
+
+        // Without a mapped neighbor every filtered target vertex is a candidate
+        const std::vector<size_t> & back = back_neighbors[depth];
+        if ( back.empty() ) {
+            for ( size_t c = domain.findFirst(); c != Bitset::npos; c = domain.findNext(c) ) {
+                if ( feasible(state, depth, c) ) { found_candidates.push_back(c); }
+            }
+            return;
+        }
+
+        // Otherwise scan the shortest row among the mapped neighbors' images
+        size_t anchor = state.image[back[0]];
+        for ( size_t earlier : back ) {
+            size_t image = state.image[earlier];
+            if ( target_offsets[image + 1] - target_offsets[image]
+                    < target_offsets[anchor + 1] - target_offsets[anchor] ) {
+                anchor = image;
+            }
+        }
+        for ( size_t at = target_offsets[anchor]; at < target_offsets[anchor + 1]; at++ ) {
+            size_t c = target_neighbors[at];
+            if ( domain.test(c) && feasible(state, depth, c) ) { found_candidates.push_back(c); }
+        }
+    }
+
+    bool SubgraphSearch::tick(State& state) {
+        // Only look at the clock every so often
+        if ( (++state.nodes & 1023) == 0 && timeout.count() > 0
+                && std::chrono::steady_clock::now() > deadline ) {
+            timed_out.store(true);
+            stopped.store(true);
+        }
+
+        return !stopped.load(std::memory_order_relaxed);
+    }
+
+    void SubgraphSearch::emit(State& state, const callback_t* callback) {
+        if ( callback == nullptr ) {
+            size_t position = found.fetch_add(1) + 1;
+            if ( limit != 0 && position >= limit ) { stopped.store(true); }
+            return;
+        }
+
+        vfunc_t vertex_map;
+        for ( size_t depth = 0; depth < order.size(); depth++ ) {
+            vertex_map[pattern_index.idOf(order[depth])] = target_index.idOf(state.image[depth]);
+        }
+
+        // Serialize callbacks and count them under the lock, so a limit is
+        // met exactly; matches found after a stop are dropped
+        std::lock_guard<std::mutex> lock(emit_mutex);
+        if ( stopped.load() ) { return; }
+        reported++;
+        if ( !(*callback)(vertex_map) || (limit != 0 && reported >= limit) ) { stopped.store(true); }
+    }
+
+    void SubgraphSearch::extend(State& state, size_t depth, const callback_t* callback) {
+        if ( depth == order.size() ) {
+            emit(state, callback);
+            return;
+        }
+
+        candidates(state, depth);
+        for ( size_t c : state.buffers[depth] ) {
+            if ( !tick(state) ) { return; }
+
+            state.image[depth] = c;
+            if ( kind != MatchKind::HOMOMORPHISM ) { state.used.set(c); }
+            extend(state, depth + 1, callback);
+            if ( kind != MatchKind::HOMOMORPHISM ) { state.used.reset(c); }
+        }
+    }
+
+    void SubgraphSearch::runParallel(size_t workers, const callback_t* callback) {
+        // Split deeper when the first vertex has too few candidates to go around
+        size_t split_depth = domains[order[0]].count() >= 16 * workers ? 1 : 2;
+        split_depth = std::min(split_depth, order.size());
+
+        std::vector<TaskQueue> queues(workers);
+        std::atomic<size_t> outstanding(1);
+        queues[0].tasks.push_back(std::vector<size_t>());
+
+        parallelFor(0, workers, workers, [&](size_t, size_t, size_t worker) {
+            State state = makeState();
+            std::vector<size_t> prefix;
+            while ( !stopped.load() ) {
+                // Pop own newest task, otherwise steal another worker's oldest
+                bool have = false;
+                {
+                    std::lock_guard<std::mutex> lock(queues[worker].mutex);
+                    if ( !queues[worker].tasks.empty() ) {
+                        prefix = std::move(queues[worker].tasks.back());
+                        queues[worker].tasks.pop_back();
+                        have = true;
+                    }
+                }
+                for ( size_t offset = 1; !have && offset < workers; offset++ ) {
+                    TaskQueue & victim = queues[(worker + offset) % workers];
+                    std::lock_guard<std::mutex> lock(victim.mutex);
+                    if ( !victim.tasks.empty() ) {
+                        prefix = std::move(victim.tasks.front());
+                        victim.tasks.pop_front();
+                        have = true;
+                    }
+                }
+                if ( !have ) {
+                    if ( outstanding.load() == 0 ) { break; }
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                try {
+                    // Replay the prefix into this worker's state
+                    size_t depth = prefix.size();
+                    state.used.clear();
+                    for ( size_t earlier = 0; earlier < depth; earlier++ ) {
+                        state.image[earlier] = prefix[earlier];
+                        if ( kind != MatchKind::HOMOMORPHISM ) { state.used.set(prefix[earlier]); }
+                    }
+
+                    if ( depth < split_depth ) {
+                        // Publish children for others to steal
+                        candidates(state, depth);
+                        std::lock_guard<std::mutex> lock(queues[worker].mutex);
+                        for ( size_t c : state.buffers[depth] ) {
+                            std::vector<size_t> child(prefix);
+                            child.push_back(c);
+                            outstanding.fetch_add(1);
+                            queues[worker].tasks.push_back(std::move(child));
+                        }
+                    } else {
+                        extend(state, depth, callback);
+                    }
+                } catch ( ... ) {
+                    // Release the other workers before passing the error on
+                    stopped.store(true);
+                    throw;
+                }
+                outstanding.fetch_sub(1);
+            }
+        });
+    }
+
+    size_t SubgraphSearch::run(const callback_t* callback) {
+        stopped.store(false);
+        timed_out.store(false);
+        found.store(0);
+        reported = 0;
+        deadline = std::chrono::steady_clock::now() + timeout;
+
+        // An empty domain rules out every match up front
+        for ( const Bitset & domain : domains ) {
+            if ( domain.none() ) { return 0; }
+        }
+
+        size_t workers = resolveThreads(threads);
+        if ( workers <= 1 || order.empty() ) {
+            State state = makeState();
+            extend(state, 0, callback);
+        } else {
+            runParallel(workers, callback);
+        }
+
+        if ( callback != nullptr ) { return reported; }
+        return limit != 0 ? std::min(found.load(), limit) : found.load();
+    }
+
+    size_t SubgraphSearch::enumerate(const callback_t& callback) {
+        return run(&callback);
+    }
+
+    size_t SubgraphSearch::count() {
+        return run(nullptr);
+    }
+
+    bool SubgraphSearch::first(vfunc_t& out) {
+        size_t saved_limit = limit;
+        limit = 1;
+        size_t matches = enumerate([&out](const vfunc_t & vertex_map) {
+            out = vertex_map;
+            return false;
+        });
+        limit = saved_limit;
+
+        return matches != 0;
+    }
+
+    std::vector<Homomorphism> SubgraphSearch::find() {
+        std::vector<vfunc_t> vertex_maps;
+        enumerate([&vertex_maps](const vfunc_t & vertex_map) {
+            vertex_maps.push_back(vertex_map);
+            return true;
+        });
+
+        std::vector<Homomorphism> matches;
+        matches.reserve(vertex_maps.size());
+        for ( vfunc_t & vertex_map : vertex_maps ) {
+            matches.emplace_back(pattern, target, std::move(vertex_map));
+        }
+        return matches;
+    }
+
+}
@@ -0,0 +1,28 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "SubgraphSearch.h"
+
+static void BM_SubgraphSearchTriangles(benchmark::State & state) {
+    grapph::Graph target = randomGraph(state.range(0), state.range(1));
+    grapph::Graph triangle({ 0, 1, 2 }, { { 0, 1 }, { 1, 2 }, { 2, 0 } });
+    grapph::SubgraphSearch search(triangle, target);
+    search.setThreads(state.range(2));
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(search.count());
+    }
+}
+BENCHMARK(BM_SubgraphSearchTriangles)->Args({1 << 12, 16, 1})->Args({1 << 12, 16, 0})->Unit(benchmark::kMillisecond);
+
+static void BM_SubgraphSearchInducedPaths(benchmark::State & state) {
+    grapph::Graph target = randomGraph(state.range(0), state.range(1));
+    grapph::Graph path({ 0, 1, 2, 3 }, { { 0, 1 }, { 1, 2 }, { 2, 3 } });
+    grapph::SubgraphSearch search(path, target, grapph::MatchKind::INDUCED);
+    search.setThreads(state.range(2));
+
+    for ( auto _ : state ) {
+        benchmark::DoNotOptimize(search.count());
+    }
+}
+BENCHMARK(BM_SubgraphSearchInducedPaths)->Args({1 << 10, 8, 1})->Args({1 << 10, 8, 0})->Unit(benchmark::kMillisecond);
@@ -0,0 +1,149 @@
+#include "gtest/gtest.h"
+
+#include "Graph.h"
+#include "SubgraphSearch.h"
+
+static grapph::Graph complete(size_t n) {
+    grapph::Graph graph;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < n; u++ ) {
+        for ( grapph::vertex_t w = u + 1; w < n; w++ ) { graph.addEdge(u, w); }
+    }
+
+    return graph;
+}
+
+static grapph::Graph path(size_t n) {
+    grapph::Graph graph;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { graph.addVertex(u); }
+    for ( grapph::vertex_t u = 1; u < n; u++ ) { graph.addEdge(u - 1, u); }
+
+    return graph;
+}
+
+TEST(SubgraphSearchTest, TestCountKinds) {
+    // Path on three vertices into K4
+    grapph::Graph p3 = path(3);
+    grapph::Graph k4 = complete(4);
+
+    // Assertions
+    ASSERT_EQ(36, grapph::SubgraphSearch(p3, k4, grapph::MatchKind::HOMOMORPHISM).count());
+    ASSERT_EQ(24, grapph::SubgraphSearch(p3, k4, grapph::MatchKind::MONOMORPHISM).count());
+    ASSERT_EQ(0, grapph::SubgraphSearch(p3, k4, grapph::MatchKind::INDUCED).count());
+
+    // Triangle into K4 is the same for every kind
+    grapph::Graph k3 = complete(3);
+    ASSERT_EQ(24, grapph::SubgraphSearch(k3, k4, grapph::MatchKind::HOMOMORPHISM).count());
+    ASSERT_EQ(24, grapph::SubgraphSearch(k3, k4, grapph::MatchKind::INDUCED).count());
+}
+
+TEST(SubgraphSearchTest, TestColorings) {
+    // Homomorphisms into a triangle are proper 3-colorings: 2^5 - 2 for a pentagon
+    grapph::Graph pentagon({ 0, 1, 2, 3, 4 }, { { 0, 1 }, { 1, 2 }, { 2, 3 },
+                                                { 3, 4 }, { 4, 0 } });
+    grapph::Graph triangle = complete(3);
+    grapph::SubgraphSearch search(pentagon, triangle, grapph::MatchKind::HOMOMORPHISM);
+
+    // Assertions
+    ASSERT_EQ(30, search.count());
+    std::vector<grapph::Homomorphism> matches = search.find();
+    ASSERT_EQ(30, matches.size());
+    for ( grapph::Homomorphism & hmm : matches ) {
+        ASSERT_TRUE(hmm.isSurjective());
+    }
+
+    // No pentagon inside a triangle
+    ASSERT_EQ(0, grapph::SubgraphSearch(pentagon, triangle).count());
+}
+
+TEST(SubgraphSearchTest, TestSparseIdsAndLoops) {
+    // Pattern edge with a loop, target with gaps in its ids
+    grapph::Graph pattern({ 4, 9 }, { { 4, 9 }, { 9, 9 } });
+    grapph::Graph target({ 10, 20, 30 }, { { 10, 20 }, { 20, 30 }, { 30, 30 } });
+
+    // Only 9 -> 30 carries the loop
+    grapph::vfunc_t match;
+    ASSERT_TRUE(grapph::SubgraphSearch(pattern, target).first(match));
+    ASSERT_EQ(20, match[4]);
+    ASSERT_EQ(30, match[9]);
+    ASSERT_EQ(1, grapph::SubgraphSearch(pattern, target, grapph::MatchKind::INDUCED).count());
+
+    // Induced search cannot map a loopless vertex onto a loop
+    grapph::Graph edge({ 0, 1 }, { { 0, 1 } });
+    ASSERT_EQ(2, grapph::SubgraphSearch(edge, target, grapph::MatchKind::INDUCED).count());
+    ASSERT_EQ(4, grapph::SubgraphSearch(edge, target, grapph::MatchKind::MONOMORPHISM).count());
+    ASSERT_EQ(5, grapph::SubgraphSearch(edge, target, grapph::MatchKind::HOMOMORPHISM).count());
+
+    // The empty pattern matches once
+    grapph::Graph empty;
+    ASSERT_EQ(1, grapph::SubgraphSearch(empty, target).count());
+}
+
+TEST(SubgraphSearchTest, TestLimitAndCallback) {
+    grapph::Graph k3 = complete(3);
+    grapph::Graph k6 = complete(6);
+    grapph::SubgraphSearch search(k3, k6);
+
+    // Assertions
+    ASSERT_EQ(120, search.count());
+    ASSERT_EQ(7, search.setLimit(7).count());
+    ASSERT_EQ(7, search.find().size());
+
+    size_t seen = 0;
+    size_t reported = search.setLimit(0).enumerate([&seen](const grapph::vfunc_t &) {
+        return ++seen < 3;
+    });
+    ASSERT_EQ(3, reported);
+    ASSERT_EQ(3, seen);
+    ASSERT_FALSE(search.timedOut());
+}
+
+TEST(SubgraphSearchTest, TestParallelMatchesSerial) {
+    // Circulant graph with chords of length 1, 2 and 5
+    grapph::Graph target;
+    for ( grapph::vertex_t u = 0; u < 200; u++ ) { target.addVertex(u); }
+    for ( grapph::vertex_t u = 0; u < 200; u++ ) {
+        target.addEdge(u, (u + 1) % 200);
+        target.addEdge(u, (u + 2) % 200);
+        target.addEdge(u, (u + 5) % 200);
+    }
+    grapph::Graph k3 = complete(3);
+    grapph::Graph p4 = path(4);
+
+    // Assertions
+    for ( grapph::MatchKind kind : { grapph::MatchKind::HOMOMORPHISM, grapph::MatchKind::MONOMORPHISM,
+                                     grapph::MatchKind::INDUCED } ) {
+        ASSERT_EQ(grapph::SubgraphSearch(k3, target, kind).count(),
+                  grapph::SubgraphSearch(k3, target, kind).setThreads(4).count());
+        ASSERT_EQ(grapph::SubgraphSearch(p4, target, kind).count(),
+                  grapph::SubgraphSearch(p4, target, kind).setThreads(4).count());
+    }
+
+    size_t streamed = 0;
+    grapph::SubgraphSearch(k3, target).setThreads(4).enumerate([&streamed](const grapph::vfunc_t &) {
+        streamed++;
+        return true;
+    });
+    ASSERT_EQ(grapph::SubgraphSearch(k3, target).count(), streamed);
+    ASSERT_EQ(5, grapph::SubgraphSearch(k3, target).setThreads(4).setLimit(5).find().size());
+
+    // Workers racing for the last slots still report exactly the limit
+    for ( size_t limit = 1; limit < 40; limit++ ) {
+        ASSERT_EQ(limit, grapph::SubgraphSearch(p4, target).setThreads(4).setLimit(limit).find().size());
+    }
+}
+
+TEST(SubgraphSearchTest, TestTimeout) {
+    // Millions of paths in a clique
+    grapph::Graph p8 = path(8);
+    grapph::Graph k12 = complete(12);
+
+    // Assertions
+    grapph::SubgraphSearch serial(p8, k12);
+    serial.setTimeout(std::chrono::milliseconds(5)).count();
+    ASSERT_TRUE(serial.timedOut());
+
+    grapph::SubgraphSearch parallel(p8, k12);
+    parallel.setThreads(4).setTimeout(std::chrono::milliseconds(5)).count();
+    ASSERT_TRUE(parallel.timedOut());
+}
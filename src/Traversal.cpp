@@ -0,0 +1,212 @@
+#include "Traversal.h"
+#include "Bitset.h"
+#include "Parallel.h"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    namespace {
+
+        // Levels with fewer frontier edges than this expand on the calling
+        // thread; starting workers would cost more than the level
+        const size_t PARALLEL_LEVEL_THRESHOLD = 1 << 12;
+
+    }
+
+    const size_t ParallelBfs::npos;
+
+    size_t ParallelBfs::validate(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return position;
+    }
+
+    template <typename G>
+    void ParallelBfs::build(const G & graph) {
+        index = VertexIndex(graph.viewVertices().begin(), graph.viewVertices().end());
+
+        offsets.reserve(index.size() + 1);
+        offsets.push_back(0);
+        loops.assign(index.size(), false);
+        size_t position = 0;
+        for ( vertex_t vertex : graph.viewVertices() ) {
+            for ( vertex_t neighbor : graph.viewNeighbors(vertex) ) {
+                if ( neighbor == vertex ) { loops[position] = true; }
+                else { neighbors.push_back(index.indexOf(neighbor)); }
+            }
+            offsets.push_back(neighbors.size());
+            position++;
+        }
+
+        depths.assign(index.size(), npos);
+        parents = std::vector<std::atomic<size_t>>(index.size());
+        for ( std::atomic<size_t> & parent : parents ) { parent.store(npos, std::memory_order_relaxed); }
+    }
+
+    ParallelBfs::ParallelBfs(const Graph & graph) {
+        build(graph);
+    }
+
+    ParallelBfs::ParallelBfs(const CompactGraph & graph) {
+        build(graph);
+    }
+
+    ParallelBfs::ParallelBfs(const DenseGraph & graph) {
+        build(graph);
+    }
+
+    ParallelBfs& ParallelBfs::setThreads(size_t count) {
+        threads = count;
+        return *this;
+    }
+
+    ParallelBfs& ParallelBfs::setAlpha(size_t value) {
+        alpha = value;
+        return *this;
+    }
+
+    ParallelBfs& ParallelBfs::setBeta(size_t value) {
+        beta = value;
+        return *this;
+    }
+
+    void ParallelBfs::topDown(std::vector<size_t> & frontier, size_t depth, size_t workers) {
+        std::vector<std::vector<size_t>> next(workers);
+        parallelFor(0, frontier.size(), workers, [&](size_t lo, size_t hi, size_t worker) {
+            std::vector<size_t> & reached = next[worker];
+            for ( size_t i = lo; i < hi; i++ ) {
+                size_t u = frontier[i];
+                for ( size_t k = offsets[u]; k < offsets[u + 1]; k++ ) {
+                    size_t v = neighbors[k];
+                    if ( parents[v].load(std::memory_order_relaxed) != npos ) { continue; }
+
+                    // Only the worker whose claim lands writes v's depth
+                    size_t unclaimed = npos;
+                    if ( parents[v].compare_exchange_strong(unclaimed, u, std::memory_order_relaxed) ) {
+                        depths[v] = depth;
+                        reached.push_back(v);
+                    }
+                }
+            }
+        });
+
+        frontier.clear();
+        for ( const std::vector<size_t> & reached : next ) { frontier.insert(frontier.end(), reached.begin(), reached.end()); }
+    }
+
+    void ParallelBfs::bottomUp(std::vector<size_t> & frontier, size_t depth, size_t workers) {
+        Bitset in_frontier(index.size());
+        for ( size_t u : frontier ) { in_frontier.set(u); }
+
+        // Each worker owns a range of positions, so no claims race
+        std::vector<std::vector<size_t>> next(workers);
+        parallelFor(0, index.size(), workers, [&](size_t lo, size_t hi, size_t worker) {
+            std::vector<size_t> & reached = next[worker];
+            for ( size_t v = lo; v < hi; v++ ) {
+                if ( parents[v].load(std::memory_order_relaxed) != npos ) { continue; }
+
+                for ( size_t k = offsets[v]; k < offsets[v + 1]; k++ ) {
+                    if ( in_frontier.test(neighbors[k]) ) {
+                        parents[v].store(neighbors[k], std::memory_order_relaxed);
+                        depths[v] = depth;
+                        reached.push_back(v);
+                        break;
+                    }
+                }
+            }
+        });
+
+        frontier.clear();
+        for ( const std::vector<size_t> & reached : next ) { frontier.insert(frontier.end(), reached.begin(), reached.end()); }
+    }
+
+    size_t ParallelBfs::run(vertex_t source, const level_visitor_t & visit) {
+        size_t start = validate(source);
+        size_t workers = resolveThreads(threads);
+
+        depths.assign(index.size(), npos);
+        for ( std::atomic<size_t> & parent : parents ) { parent.store(npos, std::memory_order_relaxed); }
+        bottom_up_levels = 0;
+
+        depths[start] = 0;
+        parents[start].store(start, std::memory_order_relaxed);
+        std::vector<size_t> frontier = { start };
+
+        // Edges still to explore, and those leaving the frontier
+        size_t unexplored = neighbors.size();
+        size_t frontier_edges = offsets[start + 1] - offsets[start];
+        size_t reached_edges = 0;
+        size_t reached_loops = 0;
+        bool bottom_up = false;
+        size_t previous = 0;
+
+        std::vector<vertex_t> ids;
+        size_t depth = 0;
+        num_reached = 0;
+        while ( !frontier.empty() ) {
+            num_reached += frontier.size();
+            unexplored -= frontier_edges;
+            reached_edges += frontier_edges;
+            for ( size_t u : frontier ) { reached_loops += loops[u]; }
+
+            if ( visit ) {
+                ids.clear();
+                for ( size_t u : frontier ) { ids.push_back(index.idOf(u)); }
+                visit(depth, ids);
+            }
+
+            // Direction choice from the frontier's share of remaining work
+            if ( !bottom_up ) {
+                bottom_up = alpha != 0 && frontier_edges * alpha > unexplored;
+            } else if ( beta != 0 && frontier.size() * beta < index.size() && frontier.size() < previous ) {
+                bottom_up = false;
+            }
+            previous = frontier.size();
+
+            depth++;
+            if ( bottom_up ) {
+                bottom_up_levels++;
+                bottomUp(frontier, depth, workers);
+            } else {
+                topDown(frontier, depth, frontier_edges < PARALLEL_LEVEL_THRESHOLD ? 1 : workers);
+            }
+
+            frontier_edges = 0;
+            for ( size_t u : frontier ) { frontier_edges += offsets[u + 1] - offsets[u]; }
+        }
+
+        num_levels = depth;
+        edges_traversed = reached_edges / 2 + reached_loops;
+
+        return num_reached;
+    }
+
+    bool ParallelBfs::reached(vertex_t vertex) const {
+        return depths[validate(vertex)] != npos;
+    }
+
+    size_t ParallelBfs::getDepth(vertex_t vertex) const {
+        return depths[validate(vertex)];
+    }
+
+    vertex_t ParallelBfs::getParent(vertex_t vertex) const {
+        size_t position = validate(vertex);
+        if ( depths[position] == npos ) {
+            std::stringstream ss;
+            ss << "Vertex " << vertex << " not reached";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return index.idOf(parents[position].load(std::memory_order_relaxed));
+    }
+
+}
@@ -0,0 +1,53 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "Traversal.h"
+
+// Throughput in traversed edges per second (TEPS): edges in the reached
+// component divided by search time, reported as items per second
+
+static void BM_BreadthFirstGraph(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    size_t edges = 0;
+    for ( auto _ : state ) {
+        size_t degrees = 0;
+        grapph::breadthFirst(graph, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t) {
+            degrees += graph.viewNeighbors(u).size();
+            return true;
+        });
+        edges = degrees / 2;
+    }
+    state.SetItemsProcessed(state.iterations() * edges);
+}
+BENCHMARK(BM_BreadthFirstGraph)->Args({1 << 14, 16})->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
+
+static void BM_BreadthFirstCompactGraph(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+
+    size_t edges = 0;
+    for ( auto _ : state ) {
+        size_t degrees = 0;
+        grapph::breadthFirst(frozen, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t) {
+            degrees += frozen.getDegree(u);
+            return true;
+        });
+        edges = degrees / 2;
+    }
+    state.SetItemsProcessed(state.iterations() * edges);
+}
+BENCHMARK(BM_BreadthFirstCompactGraph)->Args({1 << 14, 16})->Args({1 << 16, 16})->Unit(benchmark::kMillisecond);
+
+// Arg 2 is the thread count, arg 3 the alpha parameter (0 stays top-down)
+static void BM_ParallelBfs(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::ParallelBfs bfs(graph);
+    bfs.setThreads(state.range(2)).setAlpha(state.range(3));
+
+    for ( auto _ : state ) { bfs.run(0); }
+    state.SetItemsProcessed(state.iterations() * bfs.getEdgesTraversed());
+    state.counters["bottom_up_levels"] = bfs.getNumBottomUpLevels();
+}
+BENCHMARK(BM_ParallelBfs)->ArgsProduct({ { 1 << 16, 1 << 18 }, { 16 }, { 1, 4 }, { 0, 15 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
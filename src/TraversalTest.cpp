@@ -0,0 +1,169 @@
+#include "gtest/gtest.h"
+
+#include "Traversal.h"
+
+#include <map>
+#include <random>
+
+// Random graph over 0..n-1 with a few isolated vertices and self loops
+static grapph::Graph randomGraph(size_t n, size_t edges, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, n - 5);
+
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < n; u++ ) { vertices.insert(u); }
+    std::set<grapph::edge_t> edge_set;
+    while ( edge_set.size() < edges ) {
+        grapph::vertex_t u = pick(rng);
+        grapph::vertex_t w = pick(rng);
+        edge_set.insert({ std::min(u, w), std::max(u, w) });
+    }
+
+    return grapph::Graph(vertices, edge_set);
+}
+
+TEST(TraversalTest, TestBreadthFirst) {
+    // Initialize a path 0 - 1 - 2 - 3 with a chord 0 - 2 and an isolated vertex
+    grapph::Graph graph({ 0, 1, 2, 3, 4 }, { {0, 1}, {1, 2}, {2, 3}, {0, 2} });
+
+    std::map<grapph::vertex_t, size_t> depth;
+    std::map<grapph::vertex_t, grapph::vertex_t> parent;
+    size_t visited = grapph::breadthFirst(graph, 0, [&](grapph::vertex_t u, grapph::vertex_t p, size_t d) {
+        depth[u] = d;
+        parent[u] = p;
+        return true;
+    });
+
+    // Assertions
+    ASSERT_EQ(4, visited);
+    ASSERT_EQ(0, depth[0]);
+    ASSERT_EQ(1, depth[1]);
+    ASSERT_EQ(1, depth[2]);
+    ASSERT_EQ(2, depth[3]);
+    ASSERT_EQ(2, parent[3]);
+    ASSERT_EQ(0, depth.count(4));
+    ASSERT_THROW(grapph::breadthFirst(graph, 7, [](grapph::vertex_t, grapph::vertex_t, size_t) { return true; }),
+                 std::invalid_argument);
+
+    // Stop once vertex 2 is reached
+    size_t stopped = grapph::breadthFirst(graph, 0, [](grapph::vertex_t u, grapph::vertex_t, size_t) { return u != 2; });
+    ASSERT_EQ(3, stopped);
+}
+
+TEST(TraversalTest, TestDepthFirst) {
+    // Initialize a star around 0 with a path hanging off 1, frozen
+    grapph::Graph graph({ 0, 1, 2, 3, 5, 6 }, { {0, 1}, {0, 2}, {0, 3}, {1, 5}, {5, 6}, {6, 6} });
+    grapph::CompactGraph frozen(graph);
+
+    std::vector<grapph::vertex_t> order;
+    std::vector<size_t> depths;
+    size_t visited = grapph::depthFirst(frozen, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t d) {
+        order.push_back(u);
+        depths.push_back(d);
+        return true;
+    });
+
+    // Assertions
+    ASSERT_EQ(6, visited);
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 0, 1, 5, 6, 2, 3 }), order);
+    ASSERT_EQ(std::vector<size_t>({ 0, 1, 2, 3, 1, 1 }), depths);
+    ASSERT_EQ(6, grapph::depthFirst(graph, 0, [](grapph::vertex_t, grapph::vertex_t, size_t) { return true; }));
+}
+
+TEST(TraversalTest, TestParallelBfsMatchesSerial) {
+    grapph::Graph graph = randomGraph(2000, 6000, 3);
+
+    std::map<grapph::vertex_t, size_t> expected;
+    grapph::breadthFirst(graph, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t d) {
+        expected[u] = d;
+        return true;
+    });
+
+    // Pure top-down, pure bottom-up after the source, and the default switching
+    std::vector<std::pair<size_t, size_t>> settings = { { 0, 0 }, { 1 << 30, 0 }, { 15, 18 } };
+    for ( const std::pair<size_t, size_t> & setting : settings ) {
+        for ( size_t threads : { 1, 4 } ) {
+            grapph::ParallelBfs bfs(graph);
+            bfs.setThreads(threads).setAlpha(setting.first).setBeta(setting.second);
+
+            // Assertions
+            ASSERT_EQ(expected.size(), bfs.run(0));
+            for ( grapph::vertex_t u : graph.viewVertices() ) {
+                if ( expected.count(u) == 0 ) {
+                    ASSERT_FALSE(bfs.reached(u));
+                    ASSERT_TRUE(bfs.getDepth(u) == grapph::ParallelBfs::npos);
+                    ASSERT_THROW(bfs.getParent(u), std::invalid_argument);
+                    continue;
+                }
+                ASSERT_EQ(expected[u], bfs.getDepth(u));
+                grapph::vertex_t parent = bfs.getParent(u);
+                if ( u == 0 ) {
+                    ASSERT_EQ(0, parent);
+                } else {
+                    ASSERT_TRUE(graph.adjacent(u, parent));
+                    ASSERT_EQ(expected[u] - 1, bfs.getDepth(parent));
+                }
+            }
+
+            if ( setting.first == 0 ) { ASSERT_EQ(0, bfs.getNumBottomUpLevels()); }
+            if ( setting.first == 1 << 30 ) { ASSERT_EQ(bfs.getNumLevels(), bfs.getNumBottomUpLevels()); }
+        }
+    }
+}
+
+TEST(TraversalTest, TestParallelBfsLevels) {
+    // Initialize a cycle on 0..5 with a self loop and an isolated vertex
+    grapph::Graph graph({ 0, 1, 2, 3, 4, 5, 9 }, { {0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {0, 5}, {3, 3} });
+    grapph::ParallelBfs bfs(graph);
+
+    std::vector<std::vector<grapph::vertex_t>> levels;
+    bfs.run(0, [&](size_t depth, const std::vector<grapph::vertex_t> & reached) {
+        ASSERT_EQ(levels.size(), depth);
+        levels.push_back(reached);
+        std::sort(levels.back().begin(), levels.back().end());
+    });
+
+    // Assertions
+    ASSERT_EQ(6, bfs.getNumReached());
+    ASSERT_EQ(4, bfs.getNumLevels());
+    ASSERT_EQ(7, bfs.getEdgesTraversed());
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 1, 5 }), levels[1]);
+    ASSERT_EQ(std::vector<grapph::vertex_t>({ 3 }), levels[3]);
+    ASSERT_FALSE(bfs.reached(9));
+    ASSERT_THROW(bfs.run(7), std::invalid_argument);
+
+    // Results are replaced by the next run
+    ASSERT_EQ(1, bfs.run(9));
+    ASSERT_FALSE(bfs.reached(0));
+    ASSERT_EQ(0, bfs.getEdgesTraversed());
+}
+
+TEST(TraversalTest, TestDenseGraph) {
+    grapph::Graph graph = randomGraph(300, 6000, 5);
+    grapph::DenseGraph dense(graph);
+
+    // Assertions; every traversal sees the same graph through the bit rows
+    std::vector<grapph::vertex_t> sparse_order;
+    std::vector<grapph::vertex_t> dense_order;
+    grapph::depthFirst(graph, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t) {
+        sparse_order.push_back(u);
+        return true;
+    });
+    grapph::depthFirst(dense, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t) {
+        dense_order.push_back(u);
+        return true;
+    });
+    ASSERT_EQ(sparse_order, dense_order);
+
+    std::map<grapph::vertex_t, size_t> expected;
+    grapph::breadthFirst(dense, 0, [&](grapph::vertex_t u, grapph::vertex_t, size_t d) {
+        expected[u] = d;
+        return true;
+    });
+    grapph::ParallelBfs bfs(dense);
+    ASSERT_EQ(expected.size(), bfs.setThreads(4).run(0));
+    for ( const std::pair<const grapph::vertex_t, size_t> & entry : expected ) {
+        ASSERT_EQ(entry.second, bfs.getDepth(entry.first));
+    }
+    ASSERT_FALSE(bfs.reached(299));
+}
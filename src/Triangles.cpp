@@ -0,0 +1,137 @@
+#include "Triangles.h"
+#include "Parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace grapph {
+
+    size_t Triangles::validate(vertex_t vertex) const {
+        size_t position = index.indexOf(vertex);
+        if ( position == VertexIndex::npos ) {
+            std::stringstream ss;
+            ss  << "Vertex "
+                << vertex
+                << " not found in graph";
+            throw std::invalid_argument(ss.str());
+        }
+
+        return position;
+    }
+
+    template <typename G>
+    void Triangles::compute(const G & graph, size_t threads, SimdLevel level) {
+        index = VertexIndex(graph.viewVertices().begin(), graph.viewVertices().end());
+        size_t n = index.size();
+
+        degrees.assign(n, 0);
+        for ( size_t v = 0; v < n; v++ ) {
+            const auto & row = graph.viewNeighbors(index.idOf(v));
+            degrees[v] = row.size() - (std::find(row.begin(), row.end(), index.idOf(v)) != row.end());
+        }
+
+        // Rank positions by degree; edges point up the ranking
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return degrees[a] != degrees[b] ? degrees[a] < degrees[b] : a < b;
+        });
+        std::vector<vertex_t> ranks(n);
+        for ( size_t r = 0; r < n; r++ ) { ranks[order[r]] = r; }
+
+        // Outgoing rows over ranks, sorted for the kernels
+        std::vector<size_t> offsets(n + 1, 0);
+        std::vector<vertex_t> targets;
+        size_t widest = 0;
+        for ( size_t r = 0; r < n; r++ ) {
+            for ( vertex_t neighbor : graph.viewNeighbors(index.idOf(order[r])) ) {
+                vertex_t rank = ranks[index.indexOf(neighbor)];
+                if ( rank > r ) { targets.push_back(rank); }
+            }
+            std::sort(targets.begin() + offsets[r], targets.end());
+            offsets[r + 1] = targets.size();
+            widest = std::max(widest, offsets[r + 1] - offsets[r]);
+        }
+
+        // Each triangle u < v < w credits all three corners
+        std::vector<std::atomic<size_t>> found(n);
+        for ( std::atomic<size_t> & count : found ) { count.store(0, std::memory_order_relaxed); }
+        size_t workers = resolveThreads(threads);
+        std::vector<size_t> totals(workers, 0);
+        parallelFor(0, n, workers, [&](size_t lo, size_t hi, size_t worker) {
+            std::vector<vertex_t> common(widest);
+            for ( size_t u = lo; u < hi; u++ ) {
+                const vertex_t * out_u = targets.data() + offsets[u];
+                size_t degree_u = offsets[u + 1] - offsets[u];
+                size_t closed = 0;
+                for ( size_t k = 0; k < degree_u; k++ ) {
+                    vertex_t v = out_u[k];
+                    // Only targets after v can close a triangle with it
+                    size_t shared = sortedIntersection(out_u + k + 1, degree_u - k - 1,
+                                                       targets.data() + offsets[v], offsets[v + 1] - offsets[v],
+                                                       common.data(), level);
+                    if ( shared == 0 ) { continue; }
+
+                    closed += shared;
+                    found[v].fetch_add(shared, std::memory_order_relaxed);
+                    for ( size_t i = 0; i < shared; i++ ) { found[common[i]].fetch_add(1, std::memory_order_relaxed); }
+                }
+                found[u].fetch_add(closed, std::memory_order_relaxed);
+                totals[worker] += closed;
+            }
+        });
+
+        counts.resize(n);
+        for ( size_t r = 0; r < n; r++ ) { counts[order[r]] = found[r].load(std::memory_order_relaxed); }
+        num_triangles = std::accumulate(totals.begin(), totals.end(), size_t(0));
+    }
+
+    Triangles::Triangles(const Graph & graph, size_t threads, SimdLevel level) {
+        compute(graph, threads, level);
+    }
+
+    Triangles::Triangles(const CompactGraph & graph, size_t threads, SimdLevel level) {
+        compute(graph, threads, level);
+    }
+
+    Triangles::Triangles(const DenseGraph & graph, size_t threads, SimdLevel level) {
+        compute(graph, threads, level);
+    }
+
+    size_t Triangles::getTriangles(vertex_t vertex) const {
+        return counts[validate(vertex)];
+    }
+
+    double Triangles::getLocalClustering(vertex_t vertex) const {
+        size_t position = validate(vertex);
+        size_t degree = degrees[position];
+        if ( degree < 2 ) { return 0; }
+
+        return 2.0 * counts[position] / (double(degree) * (degree - 1));
+    }
+
+    double Triangles::getAverageClustering() const {
+        if ( index.size() == 0 ) { return 0; }
+
+        double sum = 0;
+        for ( size_t v = 0; v < index.size(); v++ ) {
+            if ( degrees[v] >= 2 ) { sum += 2.0 * counts[v] / (double(degrees[v]) * (degrees[v] - 1)); }
+        }
+
+        return sum / index.size();
+    }
+
+    double Triangles::getGlobalClustering() const {
+        double wedges = 0;
+        for ( size_t degree : degrees ) {
+            if ( degree >= 2 ) { wedges += double(degree) * (degree - 1) / 2; }
+        }
+        if ( wedges == 0 ) { return 0; }
+
+        return 3.0 * num_triangles / wedges;
+    }
+
+}
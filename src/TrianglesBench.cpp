@@ -0,0 +1,35 @@
+#include "benchmark/benchmark.h"
+
+#include "BenchGraphs.h"
+#include "Triangles.h"
+
+// Counting by adjacency tests over each edge and a third vertex
+static void BM_TrianglesNaive(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+
+    for ( auto _ : state ) {
+        size_t total = 0;
+        for ( const grapph::edge_t & edge : graph.viewEdges() ) {
+            for ( grapph::vertex_t w : graph.viewNeighbors(edge.second) ) {
+                if ( w > edge.second && graph.adjacent(edge.first, w) ) { total++; }
+            }
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * graph.viewEdges().size());
+}
+BENCHMARK(BM_TrianglesNaive)->Args({1 << 14, 16})->Unit(benchmark::kMillisecond);
+
+// Arg 2 is the thread count, arg 3 the SimdLevel
+static void BM_Triangles(benchmark::State & state) {
+    grapph::Graph graph = randomGraph(state.range(0), state.range(1));
+    grapph::CompactGraph frozen(graph);
+
+    for ( auto _ : state ) {
+        grapph::Triangles triangles(frozen, state.range(2), static_cast<grapph::SimdLevel>(state.range(3)));
+        benchmark::DoNotOptimize(triangles.getNumTriangles());
+    }
+    state.SetItemsProcessed(state.iterations() * frozen.getNumEdges());
+}
+BENCHMARK(BM_Triangles)->ArgsProduct({ { 1 << 14, 1 << 17 }, { 16 }, { 1, 4 }, { 1, 0 } })
+        ->Unit(benchmark::kMillisecond)->UseRealTime();
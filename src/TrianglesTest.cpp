@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+
+#include "Triangles.h"
+
+#include <random>
+
+TEST(TrianglesTest, TestSmallGraph) {
+    // Initialize two triangles sharing edge (2, 3), a tail, a self loop, and an isolated vertex
+    grapph::Graph graph({ 1, 2, 3, 4, 5, 6 }, { {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 5}, {5, 5} });
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::Triangles triangles(graph, threads);
+
+        // Assertions
+        ASSERT_EQ(2, triangles.getNumTriangles());
+        ASSERT_EQ(1, triangles.getTriangles(1));
+        ASSERT_EQ(2, triangles.getTriangles(2));
+        ASSERT_EQ(0, triangles.getTriangles(5));
+        ASSERT_DOUBLE_EQ(1.0, triangles.getLocalClustering(1));
+        ASSERT_DOUBLE_EQ(2.0 / 3, triangles.getLocalClustering(2));
+        ASSERT_DOUBLE_EQ(1.0 / 3, triangles.getLocalClustering(4));
+        ASSERT_DOUBLE_EQ(0.0, triangles.getLocalClustering(5));
+        ASSERT_DOUBLE_EQ((1.0 + 2.0 / 3 + 2.0 / 3 + 1.0 / 3) / 6, triangles.getAverageClustering());
+        // 6 closed wedges out of 1 + 3 + 3 + 3
+        ASSERT_DOUBLE_EQ(0.6, triangles.getGlobalClustering());
+        ASSERT_THROW(triangles.getTriangles(7), std::invalid_argument);
+    }
+
+    grapph::Graph empty;
+    ASSERT_EQ(0, grapph::Triangles(empty).getNumTriangles());
+    ASSERT_DOUBLE_EQ(0.0, grapph::Triangles(empty).getGlobalClustering());
+}
+
+TEST(TrianglesTest, TestDenseGraph) {
+    // Same graph as above through the bit matrix; the self loop is a set bit
+    grapph::Graph graph({ 1, 2, 3, 4, 5, 6 }, { {1, 2}, {1, 3}, {2, 3}, {2, 4}, {3, 4}, {4, 5}, {5, 5} });
+    grapph::DenseGraph dense(graph);
+
+    for ( size_t threads : { 1, 4 } ) {
+        grapph::Triangles sparse(graph, threads);
+        grapph::Triangles triangles(dense, threads);
+
+        // Assertions
+        ASSERT_EQ(2, triangles.getNumTriangles());
+        for ( grapph::vertex_t u : graph.viewVertices() ) {
+            ASSERT_EQ(sparse.getTriangles(u), triangles.getTriangles(u));
+            ASSERT_DOUBLE_EQ(sparse.getLocalClustering(u), triangles.getLocalClustering(u));
+        }
+        ASSERT_DOUBLE_EQ(sparse.getGlobalClustering(), triangles.getGlobalClustering());
+    }
+}
+
+TEST(TrianglesTest, TestMatchesNaive) {
+    // Random graph dense enough for plenty of triangles
+    std::mt19937_64 rng(11);
+    std::uniform_int_distribution<grapph::vertex_t> pick(0, 149);
+    std::set<grapph::vertex_t> vertices;
+    for ( grapph::vertex_t u = 0; u < 150; u++ ) { vertices.insert(u * 3); }
+    std::set<grapph::edge_t> edges;
+    while ( edges.size() < 1500 ) {
+        grapph::vertex_t u = pick(rng) * 3;
+        grapph::vertex_t w = pick(rng) * 3;
+        edges.insert({ std::min(u, w), std::max(u, w) });
+    }
+    grapph::Graph graph(vertices, edges);
+    grapph::CompactGraph frozen(graph);
+
+    // Count by testing every triple
+    std::vector<grapph::vertex_t> ids(vertices.begin(), vertices.end());
+    std::map<grapph::vertex_t, size_t> expected;
+    size_t total = 0;
+    for ( size_t i = 0; i < ids.size(); i++ ) {
+        for ( size_t j = i + 1; j < ids.size(); j++ ) {
+            if ( !graph.adjacent(ids[i], ids[j]) ) { continue; }
+            for ( size_t k = j + 1; k < ids.size(); k++ ) {
+                if ( graph.adjacent(ids[i], ids[k]) && graph.adjacent(ids[j], ids[k]) ) {
+                    total++;
+                    expected[ids[i]]++;
+                    expected[ids[j]]++;
+                    expected[ids[k]]++;
+                }
+            }
+        }
+    }
+
+    for ( grapph::SimdLevel level : { grapph::SimdLevel::SCALAR, grapph::SimdLevel::AUTO } ) {
+        grapph::Triangles serial(graph, 1, level);
+        grapph::Triangles parallel(frozen, 4, level);
+
+        // Assertions
+        ASSERT_EQ(total, serial.getNumTriangles());
+        ASSERT_EQ(total, parallel.getNumTriangles());
+        for ( grapph::vertex_t u : ids ) {
+            ASSERT_EQ(expected[u], serial.getTriangles(u));
+            ASSERT_EQ(expected[u], parallel.getTriangles(u));
+        }
+        ASSERT_DOUBLE_EQ(serial.getGlobalClustering(), parallel.getGlobalClustering());
+    }
+}